@@ -0,0 +1,169 @@
+// Blur benchmark and image diff. Renders a test card, blurs it with the
+// single-pass box shader (BeginBlurMode) and with the blur pipeline
+// (downsampled separable Gaussian, DrawBlur), then reports the time per
+// blur, the per-frame cost of a cached blurred snapshot, and how far the
+// two blurs differ per channel (0-255). The pipeline matches the box
+// blur's variance, so the two must agree within MAX_MEAN_DIFF on average
+// and MAX_DIFF anywhere, and the pipeline must move the card by at least
+// MIN_BLUR_DIFF; otherwise the radius is flagged REGRESSED and the process
+// exits with status 2.
+//
+// Needs a GPU: software GL ignores shaders, so the box path comes out
+// unblurred and every radius fails. Build with -DFUMBO_BUILD_BENCH=ON,
+// then run bench_blur [radius ...] (default 4 8 16).
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../fumbo.hpp"
+#include "rlgl.h"
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int WIDTH = 1280;
+constexpr int HEIGHT = 720;
+constexpr int ITERATIONS = 50;
+
+// Per-channel limits (0-255). Box and Gaussian part most at hard edges;
+// downsampling for large radii adds a little more.
+constexpr double MAX_MEAN_DIFF = 4.0;
+constexpr int MAX_DIFF = 32;
+constexpr double MIN_BLUR_DIFF = 1.0; // Pipeline vs the unblurred card
+
+Texture2D MakeTestCard() {
+  Image card = GenImageChecked(WIDTH, HEIGHT, 32, 32, DARKBLUE, RAYWHITE);
+  for (int i = 0; i < 12; i++) {
+    ImageDrawCircle(&card, 100 + i * 100, 360, 20 + i * 3,
+                    ColorFromHSV(i * 30.0f, 0.8f, 0.9f));
+  }
+  ImageDrawRectangle(&card, 200, 100, 880, 8, BLACK);
+  ImageDrawText(&card, "FUMBO BLUR", 420, 560, 80, MAROON);
+  Texture2D texture = LoadTextureFromImage(card);
+  UnloadImage(card);
+  return texture;
+}
+
+// Draws one blur per iteration to the back buffer; reading the screen
+// back at the end waits for the GPU, so the total covers the real work
+template <typename Fn> double MsPerBlur(Fn &&blur) {
+  auto start = Clock::now();
+  BeginDrawing();
+  for (int i = 0; i < ITERATIONS; i++) {
+    blur();
+  }
+  rlDrawRenderBatchActive();
+  Image sync = LoadImageFromScreen();
+  EndDrawing();
+  UnloadImage(sync);
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+             .count() /
+         ITERATIONS;
+}
+
+Image Capture(void (*draw)(Texture2D, float), Texture2D card, float radius) {
+  BeginDrawing();
+  ClearBackground(BLANK);
+  draw(card, radius);
+  rlDrawRenderBatchActive();
+  Image image = LoadImageFromScreen();
+  EndDrawing();
+  return image;
+}
+
+struct ImageDiff {
+  double mean;
+  int worst;
+};
+
+ImageDiff CompareImages(Image first, Image second) {
+  Color *a = LoadImageColors(first);
+  Color *b = LoadImageColors(second);
+  double sum = 0.0;
+  int worst = 0;
+  for (int i = 0; i < WIDTH * HEIGHT; i++) {
+    const int diffs[3] = {std::abs(a[i].r - b[i].r),
+                          std::abs(a[i].g - b[i].g),
+                          std::abs(a[i].b - b[i].b)};
+    for (int diff : diffs) {
+      sum += diff;
+      worst = diff > worst ? diff : worst;
+    }
+  }
+  UnloadImageColors(a);
+  UnloadImageColors(b);
+  return {sum / (WIDTH * HEIGHT * 3.0), worst};
+}
+
+void DrawUnblurred(Texture2D card, float) { DrawTextureV(card, {0, 0}, WHITE); }
+
+void DrawBoxBlur(Texture2D card, float radius) {
+  auto &shaders = Fumbo::ShaderManager::Instance();
+  shaders.BeginBlurMode(radius);
+  DrawTextureV(card, {0, 0}, WHITE);
+  shaders.EndBlurMode();
+}
+
+void DrawPipelineBlur(Texture2D card, float radius) {
+  Fumbo::ShaderManager::Instance().DrawBlur(card, {0, 0}, radius);
+}
+
+int main(int argc, char **argv) {
+  std::vector<float> radii;
+  for (int i = 1; i < argc; i++) {
+    float radius = (float)std::atof(argv[i]);
+    if (radius <= 0.0f) {
+      std::fprintf(stderr, "Usage: %s [radius ...]\n", argv[0]);
+      return 1;
+    }
+    radii.push_back(radius);
+  }
+  if (radii.empty()) {
+    radii = {4.0f, 8.0f, 16.0f};
+  }
+
+  SetTraceLogLevel(LOG_WARNING);
+  SetConfigFlags(FLAG_WINDOW_HIDDEN);
+  InitWindow(WIDTH, HEIGHT, "bench_blur");
+  if (!IsWindowReady()) {
+    std::fprintf(stderr, "No window available\n");
+    return 1;
+  }
+  Fumbo::ShaderManager::Instance().Init(WIDTH, HEIGHT);
+  Texture2D card = MakeTestCard();
+
+  std::printf("%-8s %12s %12s %12s %10s %10s %10s\n", "radius", "box ms",
+              "pipeline ms", "snapshot ms", "mean diff", "max diff",
+              "blurred");
+  bool regressed = false;
+  for (float radius : radii) {
+    double boxMs = MsPerBlur([&] { DrawBoxBlur(card, radius); });
+    double pipelineMs = MsPerBlur([&] { DrawPipelineBlur(card, radius); });
+    auto &shaders = Fumbo::ShaderManager::Instance();
+    shaders.CaptureBlurredSnapshot(card, radius);
+    double snapshotMs = MsPerBlur([&] { shaders.DrawBlurredSnapshot(); });
+
+    Image unblurred = Capture(DrawUnblurred, card, radius);
+    Image box = Capture(DrawBoxBlur, card, radius);
+    Image pipeline = Capture(DrawPipelineBlur, card, radius);
+    ImageDiff diff = CompareImages(box, pipeline);
+    ImageDiff blurred = CompareImages(unblurred, pipeline);
+    UnloadImage(unblurred);
+    UnloadImage(box);
+    UnloadImage(pipeline);
+
+    bool ok = diff.mean <= MAX_MEAN_DIFF && diff.worst <= MAX_DIFF &&
+              blurred.mean >= MIN_BLUR_DIFF;
+    regressed |= !ok;
+    std::printf("%-8.1f %12.3f %12.3f %12.3f %10.2f %10d %10.2f%s\n", radius,
+                boxMs, pipelineMs, snapshotMs, diff.mean, diff.worst,
+                blurred.mean, ok ? "" : "  REGRESSED");
+  }
+
+  UnloadTexture(card);
+  Fumbo::ShaderManager::Instance().Cleanup();
+  CloseWindow();
+  return regressed ? 2 : 0;
+}
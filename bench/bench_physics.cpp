@@ -0,0 +1,545 @@
+// Headless physics benchmark. Runs fixed, seeded scenarios without opening
+// a window and reports steps/sec, ns per body-step, heap allocations per
+// step (FUMBO_COUNT_HEAP_ALLOCS builds) and a per-scenario stability
+// metric. Use --json to save results and compare engine versions. Each
+// metric has an accepted range; a run outside it is flagged REGRESSED and
+// the process exits with status 2.
+//
+// Build with -DFUMBO_BUILD_BENCH=ON, then run bench_physics -h.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "../fumbo.hpp"
+
+using namespace Fumbo::Graphic2D;
+
+// ===== Helpers =====
+
+// Small LCG so every run builds exactly the same scenes
+struct Random {
+  uint32_t state = 12345;
+
+  float Next() {
+    state = state * 1664525u + 1013904223u;
+    return (state >> 8) * (1.0f / 16777216.0f);
+  }
+  float Range(float min, float max) { return min + (max - min) * Next(); }
+};
+
+Object *AddBox(Physics &physics, Vector2 position, Vector2 size,
+               BodyType type) {
+  ObjectConfig config;
+  config.position = position;
+  config.size = size;
+  config.bodyType = type;
+  config.friction = 0.5f;
+  return physics.GetBody(physics.CreateBody(config));
+}
+
+Object *AddCircle(Physics &physics, Vector2 position, float radius) {
+  ObjectConfig config;
+  config.position = position;
+  Object *object = physics.GetBody(physics.CreateBody(config));
+  object->SetCircle(radius);
+  return object;
+}
+
+float MaxSpeed(const Physics &physics) {
+  float maxSpeed = 0.0f;
+  for (const auto *object : physics.GetObjects()) {
+    if (object->GetBodyType() == BodyType::Dynamic) {
+      maxSpeed = fmaxf(maxSpeed, Vector2Length(object->GetVelocity()));
+    }
+  }
+  return maxSpeed;
+}
+
+int CountOutside(const Physics &physics, Rectangle area) {
+  int count = 0;
+  for (const auto *object : physics.GetObjects()) {
+    if (object->GetBodyType() == BodyType::Dynamic &&
+        !CheckCollisionPointRec(object->GetPosition(), area)) {
+      count++;
+    }
+  }
+  return count;
+}
+
+// 10k static tiles: a 500 x 18 ground slab plus 1,000 floating platform
+// tiles, all 32px
+void BuildTileLevel(Physics &physics, Random &random) {
+  for (int row = 0; row < 18; row++) {
+    for (int column = 0; column < 500; column++) {
+      AddBox(physics, {column * 32.0f, 640.0f + row * 32.0f}, {32, 32},
+             BodyType::Static);
+    }
+  }
+  for (int platform = 0; platform < 125; platform++) {
+    Vector2 start = {random.Range(0, 15700), random.Range(100, 500)};
+    for (int tile = 0; tile < 8; tile++) {
+      AddBox(physics, {start.x + tile * 32.0f, start.y}, {32, 32},
+             BodyType::Static);
+    }
+  }
+}
+
+// ===== Scenarios =====
+
+struct Scenario {
+  const char *name;
+  const char *description;
+  int steps;
+  void (*setup)(Physics &physics, Random &random);
+  void (*step)(Physics &physics, Random &random); // Extra per-step work
+  const char *stabilityName;
+  float (*stability)(const Physics &physics); // Measured after the run
+  float stabilityMin, stabilityMax;           // Accepted range
+};
+
+// Pile: boxes dropped into a bin; they should come to rest
+void SetupPile(Physics &physics, Random &random) {
+  AddBox(physics, {0, 600}, {1000, 40}, BodyType::Static);
+  AddBox(physics, {-500, 200}, {40, 800}, BodyType::Static);
+  AddBox(physics, {500, 200}, {40, 800}, BodyType::Static);
+  for (int i = 0; i < 1000; i++) {
+    Object *box = AddBox(physics,
+                         {-460 + (i % 40) * 23.0f + random.Range(-2, 2),
+                          560 - (i / 40) * 23.0f - 40},
+                         {20, 20}, BodyType::Dynamic);
+    box->SetRestitution(0.0f);
+  }
+}
+
+float RestSpeed(const Physics &physics) { return MaxSpeed(physics); }
+
+// Level: 10k static tiles with 200 boxes running across them
+void SetupLevel(Physics &physics, Random &random) {
+  BuildTileLevel(physics, random);
+  for (int i = 0; i < 200; i++) {
+    Object *mover =
+        AddBox(physics, {random.Range(100, 15900), random.Range(0, 400)},
+               {24, 24}, BodyType::Dynamic);
+    mover->SetVelocity({random.Range(-300, 300), 0});
+    mover->SetFriction(0.0f);
+    mover->SetFixedRotation(true);
+  }
+}
+
+float FallenMovers(const Physics &physics) {
+  // Anything over the ground slab but below its top tunnelled into it;
+  // movers that ran off either end just fell, which is fine
+  int count = 0;
+  for (const auto *object : physics.GetObjects()) {
+    Vector2 position = object->GetPosition();
+    if (object->GetBodyType() == BodyType::Dynamic && position.y > 624.0f &&
+        position.x > -16.0f && position.x < 15984.0f) {
+      count++;
+    }
+  }
+  return (float)count;
+}
+
+// Bullets: 5k small circles bouncing in an arena; bullets don't hit each
+// other (layer mask), only the walls
+void SetupBullets(Physics &physics, Random &random) {
+  physics.SetGravity({0, 0});
+  AddBox(physics, {0, -520}, {1040, 40}, BodyType::Static);
+  AddBox(physics, {0, 520}, {1040, 40}, BodyType::Static);
+  AddBox(physics, {-520, 0}, {40, 1040}, BodyType::Static);
+  AddBox(physics, {520, 0}, {40, 1040}, BodyType::Static);
+
+  CollisionLayers bulletLayers;
+  bulletLayers.SetLayer(1);
+  bulletLayers.DisableLayer(1);
+  for (int i = 0; i < 5000; i++) {
+    Object *bullet = AddCircle(
+        physics, {random.Range(-480, 480), random.Range(-480, 480)}, 3.0f);
+    float angle = random.Range(0, 2 * PI);
+    float speed = random.Range(100, 400);
+    bullet->SetVelocity({cosf(angle) * speed, sinf(angle) * speed});
+    bullet->SetRestitution(1.0f);
+    bullet->SetFriction(0.0f);
+    bullet->SetDrag(0.0f);
+    bullet->SetCollisionLayers(bulletLayers);
+  }
+}
+
+float EscapedBullets(const Physics &physics) {
+  return (float)CountOutside(physics, {-500, -500, 1000, 1000});
+}
+
+// Raycast storm: 256 random rays per step against the tile level
+void SetupRaycast(Physics &physics, Random &random) {
+  BuildTileLevel(physics, random);
+}
+
+static int rayHits = 0;
+static int rayCount = 0;
+
+void StepRaycast(Physics &physics, Random &random) {
+  for (int i = 0; i < 256; i++) {
+    Vector2 origin = {random.Range(0, 16000), random.Range(0, 600)};
+    float angle = random.Range(0, 2 * PI);
+    RaycastHit hit =
+        physics.Raycast(origin, {cosf(angle), sinf(angle)}, 800.0f);
+    rayHits += hit.hit ? 1 : 0;
+    rayCount++;
+  }
+}
+
+float RayHitRate(const Physics &) {
+  return rayCount > 0 ? (float)rayHits / rayCount : 0.0f;
+}
+
+// Stacks: boxes that should stand still. The top box's drift over a long
+// run shows a stack slowly leaning over well before it falls.
+static Object *stackTop = nullptr;
+static Vector2 stackTopStart = {0, 0};
+
+Object *AddStackBox(Physics &physics, Vector2 position, float size) {
+  Object *box = AddBox(physics, position, {size, size}, BodyType::Dynamic);
+  box->SetRestitution(0.0f);
+  stackTop = box;
+  stackTopStart = position;
+  return box;
+}
+
+// Pyramid: 20 rows of boxes
+void SetupPyramid(Physics &physics, Random &) {
+  AddBox(physics, {0, 600}, {1200, 40}, BodyType::Static);
+  const int rows = 20;
+  const float size = 20.0f;
+  for (int row = 0; row < rows; row++) {
+    int count = rows - row;
+    for (int i = 0; i < count; i++) {
+      float x = (i - (count - 1) * 0.5f) * size;
+      float y = 580 - size * 0.5f - row * size;
+      AddStackBox(physics, {x, y}, size);
+    }
+  }
+}
+
+// Column: 10 boxes one on top of another
+void SetupColumn(Physics &physics, Random &) {
+  AddBox(physics, {0, 600}, {1200, 40}, BodyType::Static);
+  const float size = 20.0f;
+  for (int i = 0; i < 10; i++) {
+    AddStackBox(physics, {0, 580 - size * 0.5f - i * size}, size);
+  }
+}
+
+float TopDrift(const Physics &) {
+  return Vector2Distance(stackTop->GetPosition(), stackTopStart);
+}
+
+// Chain: 8 revolute chains of 40 links dropped from horizontal; they
+// swing and whip but must stay joined
+static std::vector<Joint> chainJoints;
+static float chainWorstError = 0.0f;
+
+void SetupChain(Physics &physics, Random &) {
+  const int chains = 8;
+  const int links = 40;
+  const float length = 20.0f;
+  chainJoints.clear();
+  chainJoints.reserve(chains * links); // Joints must not move once added
+  chainWorstError = 0.0f;
+
+  for (int chain = 0; chain < chains; chain++) {
+    Vector2 start = {chain * 1000.0f, 0.0f};
+    Object *previous = nullptr; // First link hangs from the world
+    for (int link = 0; link < links; link++) {
+      Object *box = AddBox(physics,
+                           {start.x + (link + 0.5f) * length, start.y},
+                           {length, 6}, BodyType::Dynamic);
+      box->SetCollidable(false);
+      chainJoints.push_back(MakeRevoluteJoint(
+          previous, box, {start.x + link * length, start.y}));
+      physics.AddJoint(&chainJoints.back());
+      previous = box;
+    }
+  }
+}
+
+// Distance between the two anchors of the worst joint
+float JointError(const Physics &physics) {
+  float worst = 0.0f;
+  for (const auto *joint : physics.GetJoints()) {
+    Vector2 anchorA = joint->localAnchorA;
+    if (joint->bodyA) {
+      anchorA = Vector2Add(joint->bodyA->GetPosition(),
+                           Collision::RotatePoint(anchorA, {0, 0},
+                                                  joint->bodyA->GetRotation()));
+    }
+    Vector2 anchorB = Vector2Add(
+        joint->bodyB->GetPosition(),
+        Collision::RotatePoint(joint->localAnchorB, {0, 0},
+                               joint->bodyB->GetRotation()));
+    worst = fmaxf(worst, Vector2Distance(anchorA, anchorB));
+  }
+  return worst;
+}
+
+void StepChain(Physics &physics, Random &) {
+  chainWorstError = fmaxf(chainWorstError, JointError(physics));
+}
+
+float ChainError(const Physics &) { return chainWorstError; }
+
+// Compound: 100 rotated bodies with a box and a circle fixture tumbling
+// into a bin in a deterministic world. Portable trig and strict float make
+// the state hash after a fixed run the same on every platform, so a
+// mismatch means some rotation took the libm path. Record the new hash
+// when a solver change is meant to move it.
+constexpr int COMPOUND_HASH_STEPS = 300;
+constexpr uint64_t COMPOUND_HASH = 0x2d586f86c88c1d9aull;
+static uint64_t compoundHash = 0;
+
+void BuildCompound(Physics &physics, Random &random) {
+  physics.SetDeterministic(true);
+  AddBox(physics, {0, 600}, {800, 40}, BodyType::Static);
+  AddBox(physics, {-400, 300}, {40, 600}, BodyType::Static);
+  AddBox(physics, {400, 300}, {40, 600}, BodyType::Static);
+  for (int i = 0; i < 100; i++) {
+    Object *body = AddBox(
+        physics,
+        {-315 + (i % 10) * 70.0f + random.Range(-5, 5), 500 - (i / 10) * 50.0f},
+        {30, 10}, BodyType::Dynamic);
+    body->SetRotation(random.Range(0, 360));
+
+    Fixture leg;
+    leg.offset = {0, 15};
+    leg.size = {10, 20};
+    body->AddFixture(leg);
+    Fixture head;
+    head.shape = ShapeType::Circle;
+    head.offset = {20, 0};
+    head.radius = 6;
+    body->AddFixture(head);
+  }
+}
+
+void SetupCompound(Physics &physics, Random &random) {
+  // The hash comes from a run of its own, so --steps doesn't move it
+  Physics reference;
+  Random referenceRandom = random;
+  BuildCompound(reference, referenceRandom);
+  for (int i = 0; i < COMPOUND_HASH_STEPS; i++) {
+    reference.Update(reference.GetFixedTimeStep());
+  }
+  compoundHash = reference.ComputeStateHash();
+
+  BuildCompound(physics, random);
+}
+
+float CompoundHashMatch(const Physics &) {
+  if (compoundHash == COMPOUND_HASH)
+    return 1.0f;
+  std::fprintf(stderr, "compound: state hash %016llx, expected %016llx\n",
+               (unsigned long long)compoundHash,
+               (unsigned long long)COMPOUND_HASH);
+  return 0.0f;
+}
+
+// Ranges are what a game would accept, not what the solver happens to
+// reach: a settled pile moves slower than one step of gravity adds
+// (980 / 60 px/s), nothing tunnels or escapes, a resting stack drifts a
+// few px at most over 40 seconds, no joint opens by more than a fifth of
+// its 20 px link and a deterministic run hashes the same everywhere. The
+// hit rate only checks that rays still hit the seeded level.
+const Scenario scenarios[] = {
+    {"pile", "1000 boxes dropped into a bin", 600, SetupPile, nullptr,
+     "restSpeed", RestSpeed, 0.0f, 16.0f},
+    {"level", "10k static tiles, 200 movers", 600, SetupLevel, nullptr,
+     "fallenMovers", FallenMovers, 0.0f, 0.0f},
+    {"bullets", "5000 circles bouncing in an arena", 600, SetupBullets,
+     nullptr, "escapedBullets", EscapedBullets, 0.0f, 0.0f},
+    {"raycast", "256 rays per step against 10k tiles", 60, SetupRaycast,
+     StepRaycast, "hitRate", RayHitRate, 0.70f, 0.77f},
+    {"pyramid", "20-row box pyramid at rest", 2400, SetupPyramid, nullptr,
+     "topDrift", TopDrift, 0.0f, 5.0f},
+    {"column", "10-box column at rest", 2400, SetupColumn, nullptr,
+     "topDrift", TopDrift, 0.0f, 5.0f},
+    {"chain", "8 revolute chains of 40 links", 600, SetupChain, StepChain,
+     "jointError", ChainError, 0.0f, 4.0f},
+    {"compound", "100 rotated compound bodies, deterministic", 600,
+     SetupCompound, nullptr, "hashMatch", CompoundHashMatch, 1.0f, 1.0f},
+};
+
+// ===== Runner =====
+
+struct Result {
+  const Scenario *scenario;
+  int bodies;
+  int steps;
+  double seconds;
+  double stepsPerSecond;
+  double nsPerBody;
+  double allocationsPerStep; // -1 without FUMBO_COUNT_HEAP_ALLOCS
+  float stability;
+  bool stable; // stability within the scenario's accepted range
+};
+
+Result RunScenario(const Scenario &scenario, int steps) {
+  Physics physics; // Fresh world per scenario
+  physics.SetGravity({0, 980.0f});
+  physics.SetIterations(4);
+  physics.SetFixedTimeStep(60.0f);
+  physics.SetAdaptiveSubsteps(false);
+
+  Random random;
+  scenario.setup(physics, random);
+
+  // Warm up scratch buffers so the measured steps show steady state
+  const float dt = physics.GetFixedTimeStep();
+  int warmup = steps / 10 < 10 ? steps / 10 : 10;
+  for (int i = 0; i < warmup; i++) {
+    if (scenario.step)
+      scenario.step(physics, random);
+    physics.Update(dt);
+  }
+
+  // Engine-wide operator new count; -1 when the library doesn't count
+  long allocationsBefore = Fumbo::Utils::GetHeapAllocationCount();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < steps; i++) {
+    if (scenario.step)
+      scenario.step(physics, random);
+    physics.Update(dt);
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+
+  Result result;
+  result.scenario = &scenario;
+  result.bodies = (int)physics.GetObjects().size();
+  result.steps = steps;
+  result.seconds = seconds;
+  result.stepsPerSecond = steps / seconds;
+  result.nsPerBody = seconds * 1e9 / ((double)steps * result.bodies);
+  result.allocationsPerStep =
+      allocationsBefore < 0
+          ? -1.0
+          : (double)(Fumbo::Utils::GetHeapAllocationCount() -
+                     allocationsBefore) /
+                steps;
+  result.stability = scenario.stability(physics);
+  result.stable = result.stability >= scenario.stabilityMin &&
+                  result.stability <= scenario.stabilityMax;
+  return result;
+}
+
+// Allocations per step, or `missing` when the library wasn't built to count
+const char *FormatAllocations(const Result &r, const char *missing,
+                              char *buffer, size_t size) {
+  if (r.allocationsPerStep < 0)
+    return missing;
+  std::snprintf(buffer, size, "%.3f", r.allocationsPerStep);
+  return buffer;
+}
+
+void WriteJson(const char *path, const std::vector<Result> &results) {
+  FILE *file = std::fopen(path, "w");
+  if (!file) {
+    std::fprintf(stderr, "bench_physics: can't write %s\n", path);
+    return;
+  }
+
+  std::fprintf(file, "{\n  \"benchmark\": \"bench_physics\",\n");
+  std::fprintf(file, "  \"scenarios\": [\n");
+  for (size_t i = 0; i < results.size(); i++) {
+    const Result &r = results[i];
+    char allocations[32];
+    std::fprintf(file,
+                 "    {\"name\": \"%s\", \"bodies\": %d, \"steps\": %d, "
+                 "\"seconds\": %.6f, \"stepsPerSecond\": %.2f, "
+                 "\"nsPerBody\": %.2f, \"allocationsPerStep\": %s, "
+                 "\"stabilityMetric\": \"%s\", \"stability\": %.4f, "
+                 "\"ok\": %s}%s\n",
+                 r.scenario->name, r.bodies, r.steps, r.seconds,
+                 r.stepsPerSecond, r.nsPerBody,
+                 FormatAllocations(r, "null", allocations, sizeof allocations),
+                 r.scenario->stabilityName, r.stability,
+                 r.stable ? "true" : "false",
+                 i + 1 < results.size() ? "," : "");
+  }
+  std::fprintf(file, "  ]\n}\n");
+  std::fclose(file);
+}
+
+void PrintHelp(const char *programName) {
+  std::printf("Usage: %s [options]\n\n", programName);
+  std::printf("Options: --scenario <name>  Run one scenario (repeatable)\n"
+              "         --steps <n>        Override every scenario's steps\n"
+              "         --json <file>      Write results as JSON\n"
+              "         -h, --help         Show this screen\n\n"
+              "Exits with status 2 if any stability metric leaves its "
+              "range.\n\n");
+  std::printf("Scenarios:\n");
+  for (const auto &scenario : scenarios) {
+    std::printf("  %-9s %s (%d steps, %s %g..%g)\n", scenario.name,
+                scenario.description, scenario.steps, scenario.stabilityName,
+                scenario.stabilityMin, scenario.stabilityMax);
+  }
+}
+
+int main(int argc, char **argv) {
+  std::vector<std::string> selected;
+  int stepsOverride = 0;
+  const char *jsonPath = nullptr;
+
+  for (int i = 1; i < argc; i++) {
+    if (!std::strcmp(argv[i], "-h") || !std::strcmp(argv[i], "--help")) {
+      PrintHelp(argv[0]);
+      return 0;
+    } else if (!std::strcmp(argv[i], "--scenario") && i + 1 < argc) {
+      selected.push_back(argv[++i]);
+    } else if (!std::strcmp(argv[i], "--steps") && i + 1 < argc) {
+      stepsOverride = std::atoi(argv[++i]);
+    } else if (!std::strcmp(argv[i], "--json") && i + 1 < argc) {
+      jsonPath = argv[++i];
+    } else {
+      std::fprintf(stderr, "%s: unknown option %s (use -h for help)\n",
+                   argv[0], argv[i]);
+      return 1;
+    }
+  }
+
+  std::vector<Result> results;
+  bool regressed = false;
+  std::printf("%-9s %7s %6s %12s %10s %12s  %s\n", "scenario", "bodies",
+              "steps", "steps/sec", "ns/body", "allocs/step", "stability");
+  for (const auto &scenario : scenarios) {
+    if (!selected.empty()) {
+      bool wanted = false;
+      for (const auto &name : selected) {
+        wanted = wanted || name == scenario.name;
+      }
+      if (!wanted)
+        continue;
+    }
+
+    Result r = RunScenario(scenario,
+                           stepsOverride > 0 ? stepsOverride : scenario.steps);
+    char allocations[32];
+    std::printf("%-9s %7d %6d %12.1f %10.1f %12s  %s=%.4f%s\n",
+                scenario.name, r.bodies, r.steps, r.stepsPerSecond, r.nsPerBody,
+                FormatAllocations(r, "n/a", allocations, sizeof allocations),
+                scenario.stabilityName,
+                r.stability, r.stable ? "" : "  REGRESSED");
+    regressed = regressed || !r.stable;
+    results.push_back(r);
+  }
+
+  if (jsonPath) {
+    WriteJson(jsonPath, results);
+  }
+  return regressed ? 2 : 0;
+}
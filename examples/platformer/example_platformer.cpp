@@ -8,8 +8,9 @@ void PlatformerExample::Init() {
   camera.offset = {0, 0};
   camera.target = {0, 0};
 
-  // Initialize render texture for scene
-  currentScreen = LoadRenderTexture(GetScreenWidth(), GetScreenHeight());
+  // Render texture for the scene, from the engine's shared pool
+  Fumbo::Instance().GetRenderTargetPool().Resize(
+      currentScreen, GetScreenWidth(), GetScreenHeight());
 
   // Track initial screen size
   lastScreenWidth = GetScreenWidth();
@@ -24,7 +25,9 @@ void PlatformerExample::Init() {
 
   // Setup physics
   auto &physics = Fumbo::Graphic2D::Physics::Instance();
-  physics.Clear();
+  physics.Clear(); // Also releases pooled bodies from a previous run
+  crates.clear();
+  coins.clear();
   physics.SetGravity({0, 980.0f});
   physics.SetDebugDraw(true);
   physics.SetFixedTimeStep(60.0f);
@@ -42,18 +45,17 @@ void PlatformerExample::Init() {
 
   // Create some pushable crates
   for (int i = 0; i < 3; i++) {
-    auto crate = new Fumbo::Graphic2D::Object();
-    crate->SetPosition({300.0f + i * 200.0f, 420.0f - i * 100.0f});
-    crate->SetRectangle(40 + i * 10, 40 + i * 10);
-    crate->SetMass(5.0f + i * 2.0f); // Heavier crates: 5, 7, 9 kg
-    crate->SetRestitution(0.0f);
-    crate->SetFriction(0.5f); // High friction for realistic box behavior
-
     Color colors[] = {BROWN, ORANGE, YELLOW};
-    crate->SetColor(colors[i]);
 
-    physics.AddObject(crate);
-    crates.push_back(crate);
+    Fumbo::Graphic2D::ObjectConfig config;
+    config.position = {300.0f + i * 200.0f, 420.0f - i * 100.0f};
+    config.size = {40.0f + i * 10, 40.0f + i * 10};
+    config.mass = 5.0f + i * 2.0f; // Heavier crates: 5, 7, 9 kg
+    config.restitution = 0.0f;
+    config.friction = 0.5f; // High friction for realistic box behavior
+    config.color = colors[i];
+
+    crates.push_back(physics.GetBody(physics.CreateBody(config)));
   }
 
   // Create collectible coins (non-collidable, triggers only)
@@ -61,25 +63,27 @@ void PlatformerExample::Init() {
                               {900, 350}, {400, 200}, {600, 450}};
 
   for (auto &pos : coinPositions) {
-    auto coin = new Fumbo::Graphic2D::Object();
-    coin->SetPosition({pos[0], pos[1]});
-    coin->SetCircle(8); // Smaller coins
-    coin->SetColor(YELLOW);
-    coin->SetGravityScale(0.0f); // Floating coins
-    coin->SetCollidable(false);  // No physics, just trigger
-    physics.AddObject(coin);
+    Fumbo::Graphic2D::ObjectConfig config;
+    config.position = {pos[0], pos[1]};
+    config.color = YELLOW;
+    config.gravityScale = 0.0f; // Floating coins
+
+    auto coin = physics.GetBody(physics.CreateBody(config));
+    coin->SetCircle(8);         // Smaller coins
+    coin->SetCollidable(false); // No physics, just trigger
     coins.push_back(coin);
   }
 
   // Create enemy (moving horizontally)
-  enemy = new Fumbo::Graphic2D::Object();
-  enemy->SetPosition({800, 620});
-  enemy->SetRectangle(40, 40);
-  enemy->SetColor(RED);
-  enemy->SetMass(1.0f);
-  enemy->SetGravityScale(0.0f); // Floats in air
-  enemy->SetFriction(0.0f);
-  physics.AddObject(enemy);
+  Fumbo::Graphic2D::ObjectConfig enemyConfig;
+  enemyConfig.position = {800, 620};
+  enemyConfig.size = {40, 40};
+  enemyConfig.color = RED;
+  enemyConfig.mass = 1.0f;
+  enemyConfig.gravityScale = 0.0f; // Floats in air
+  enemyConfig.friction = 0.0f;
+  enemyConfig.fixedRotation = true; // Patrols upright
+  enemy = physics.GetBody(physics.CreateBody(enemyConfig));
 
   // Give enemy initial velocity
   enemy->SetVelocity({50, 0}); // Moving right
@@ -91,70 +95,51 @@ void PlatformerExample::Cleanup() {
 
   auto &physics = Fumbo::Graphic2D::Physics::Instance();
 
-  // Clean up crates
+  // Release pooled bodies
   for (auto &crate : crates) {
-    physics.RemoveObject(crate);
-    delete crate;
+    physics.DestroyBody(crate);
   }
   crates.clear();
 
-  // Clean up coins
   for (auto &coin : coins) {
-    physics.RemoveObject(coin);
-    delete coin;
+    physics.DestroyBody(coin);
   }
   coins.clear();
 
-  // Clean up enemy
   if (enemy) {
-    physics.RemoveObject(enemy);
-    delete enemy;
+    physics.DestroyBody(enemy);
     enemy = nullptr;
   }
-
-  // Clean up platforms and player
   if (ground) {
-    physics.RemoveObject(ground);
-    delete ground;
+    physics.DestroyBody(ground);
     ground = nullptr;
   }
   if (platform1) {
-    physics.RemoveObject(platform1);
-    delete platform1;
+    physics.DestroyBody(platform1);
     platform1 = nullptr;
   }
   if (platform2) {
-    physics.RemoveObject(platform2);
-    delete platform2;
+    physics.DestroyBody(platform2);
     platform2 = nullptr;
   }
   if (player) {
-    physics.RemoveObject(player);
-    delete player;
+    physics.DestroyBody(player);
     player = nullptr;
   }
 
-  // Clean up render texture
-  if (currentScreen.id != 0) {
-    UnloadRenderTexture(currentScreen);
-    currentScreen = {0};
-  }
+  // Return pooled render targets
+  auto &targets = Fumbo::Instance().GetRenderTargetPool();
+  targets.Release(currentScreen);
+  targets.Release(maskRenderTarget);
+  targets.Release(blurRenderTarget);
 
   UnloadTexture(bgTex);
 
   // Clean up cached god rays resources
-  if (maskRenderTarget.id != 0) {
-    UnloadRenderTexture(maskRenderTarget);
-    maskRenderTarget = {0};
-  }
   if (maskShader.id != 0) {
     UnloadShader(maskShader);
     maskShader = {0};
   }
-  if (blurRenderTarget.id != 0) {
-    UnloadRenderTexture(blurRenderTarget);
-    blurRenderTarget = {0};
-  }
   if (blurShader.id != 0) {
     UnloadShader(blurShader);
     blurShader = {0};
@@ -174,21 +159,10 @@ void PlatformerExample::Update() {
   int currentWidth = GetScreenWidth();
   int currentHeight = GetScreenHeight();
   if (currentWidth != lastScreenWidth || currentHeight != lastScreenHeight) {
-    // Recreate render textures with new size
-    if (currentScreen.id != 0) {
-      UnloadRenderTexture(currentScreen);
-    }
-    currentScreen = LoadRenderTexture(currentWidth, currentHeight);
-
-    // Force recreation of god rays resources with new size
-    if (maskRenderTarget.id != 0) {
-      UnloadRenderTexture(maskRenderTarget);
-      maskRenderTarget = {0};
-    }
-    if (blurRenderTarget.id != 0) {
-      UnloadRenderTexture(blurRenderTarget);
-      blurRenderTarget = {0};
-    }
+    // Swap the scene texture for the new size; the old one goes back to
+    // the pool. The god rays targets follow the size on their own.
+    Fumbo::Instance().GetRenderTargetPool().Resize(currentScreen, currentWidth,
+                                                   currentHeight);
 
     // Update tracked size
     lastScreenWidth = currentWidth;
@@ -225,6 +199,12 @@ void PlatformerExample::Update() {
     Fumbo::Graphic2D::Physics::Instance().SetDebugDraw(showDebug);
   }
 
+  // Toggle physics profiler overlay
+  if (IsKeyPressed(KEY_F4)) {
+    auto &physics = Fumbo::Graphic2D::Physics::Instance();
+    physics.SetProfiling(!physics.IsProfilingEnabled());
+  }
+
   // Toggle render mode
   if (IsKeyPressed(KEY_F1)) {
     renderMode =
@@ -239,9 +219,7 @@ void PlatformerExample::Update() {
     if (player && player->IsCollidingWith(*it)) {
       score += 10;
       coinCounter++;
-      auto &physics = Fumbo::Graphic2D::Physics::Instance();
-      physics.RemoveObject(*it);
-      delete *it;
+      physics.DestroyBody(*it);
       it = coins.erase(it);
     } else {
       ++it;
@@ -256,9 +234,7 @@ void PlatformerExample::Update() {
     // If player is above enemy (jumping on head), kill enemy
     if (playerPos.y < enemyPos.y - 10) {
       score += 50; // Bonus for killing enemy
-      auto &physics = Fumbo::Graphic2D::Physics::Instance();
-      physics.RemoveObject(enemy);
-      delete enemy;
+      physics.DestroyBody(enemy);
       enemy = nullptr;
 
       // Bounce player up a bit
@@ -315,14 +291,27 @@ void PlatformerExample::DrawScene() {
   ClearBackground(BLANK);
   BeginMode2D(camera);
   auto &physics = Fumbo::Graphic2D::Physics::Instance();
-  for (const auto &obj : physics.GetObjects()) {
-    obj->Render(); // Use object's render method (handles circles, rectangles,
-                   // etc.)
+
+  // Only bodies on screen are drawn. Rectangles go through the sprite batch
+  // (one draw call per texture); circles and other shapes render directly
+  // on top.
+  visible.clear();
+  physics.QueryVisible(Fumbo::Utils::GetCameraWorldRect(camera), visible);
+  unbatched.clear();
+  spriteBatch.Begin();
+  for (const auto &obj : visible) {
+    if (!spriteBatch.DrawObject(obj)) {
+      unbatched.push_back(obj);
+    }
+  }
+  spriteBatch.End();
+  for (const auto &obj : unbatched) {
+    obj->Render();
   }
 
   // Draw debug info if enabled
   if (showDebug) {
-    physics.DrawDebug();
+    physics.DrawDebug(camera);
   }
   EndMode2D();
   EndTextureMode();
@@ -377,8 +366,8 @@ void PlatformerExample::DrawDirty() {
   // UI
   Fumbo::Graphic2D::DrawText("AREA 1 - 2D PLATFORMER", {10, 10}, {}, 30, WHITE);
   Fumbo::Graphic2D::DrawText(
-      "A/D: Move | SPACE: Jump | F1: Render Mode | F3: Debug", {10, 50}, {}, 20,
-      LIGHTGRAY);
+      "A/D: Move | SPACE: Jump | F1: Render Mode | F3: Debug | F4: Profiler",
+      {10, 50}, {}, 20, LIGHTGRAY);
 
   // Show current render mode
   const char *modeText = "NORMAL";
@@ -388,6 +377,10 @@ void PlatformerExample::DrawDirty() {
     modeText = "GODRAYS";
   Fumbo::Graphic2D::DrawText(TextFormat("Render Mode: %s", modeText), {10, 205},
                              {}, 20, ORANGE);
+  const auto &batchStats = spriteBatch.GetStats();
+  Fumbo::Graphic2D::DrawText(TextFormat("Sprites: %d | Batches: %d",
+                                        batchStats.sprites, batchStats.batches),
+                             {10, 235}, {}, 20, LIGHTGRAY);
 
   // Score and stats
   Fumbo::Graphic2D::DrawText(TextFormat("Score: %d", score), {10, 85}, {}, 25,
@@ -37,6 +37,11 @@ private:
   Vector2 oldEnemyPos;
   float timerDelta;
 
+  // Batched scene rendering
+  Fumbo::Graphic2D::SpriteBatch spriteBatch;
+  std::vector<Fumbo::Graphic2D::Object *> visible;
+  std::vector<Fumbo::Graphic2D::Object *> unbatched;
+
   // Render mode toggle
   enum class RenderMode { NORMAL, MASK, GODRAYS };
   RenderMode renderMode = RenderMode::NORMAL;
@@ -46,7 +51,7 @@ private:
   Shader maskShader = {0};
   RenderTexture2D blurRenderTarget = {0};
   Shader blurShader = {0};
-  RenderTexture2D currentScreen;
+  RenderTexture2D currentScreen = {0};
 
   // Track screen size for resize detection
   int lastScreenWidth = 0;
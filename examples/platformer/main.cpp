@@ -5,6 +5,14 @@ int main(int argc, char **argv) {
   // Initialize Engine
   Fumbo::Instance().Init(1280, 720, "Example Platformer", 0);
 
+  // Physics profiler readout (F4 toggles profiling in the example)
+  Fumbo::Instance().AddGlobalOverlay([] {
+    auto &physics = Fumbo::Graphic2D::Physics::Instance();
+    if (physics.IsProfilingEnabled()) {
+      physics.DrawProfileOverlay({(float)GetScreenWidth() - 270, 10});
+    }
+  });
+
   // Start Game with Splash State
   Fumbo::Instance().Run(std::make_shared<PlatformerExample>());
 
@@ -45,14 +45,12 @@ void TopDown::Cleanup() {
 
   auto &physics = Fumbo::Graphic2D::Physics::Instance();
   for (auto &wall : walls) {
-    physics.RemoveObject(wall);
-    delete wall;
+    physics.DestroyBody(wall);
   }
   walls.clear();
 
   if (player) {
-    physics.RemoveObject(player);
-    delete player;
+    physics.DestroyBody(player);
     player = nullptr;
   }
 
@@ -95,15 +93,13 @@ void TopDown::DrawClean() { Fumbo::Graphic2D::DrawBackground(bgTex); }
 void TopDown::DrawDirty() {
   BeginMode2D(camera);
 
-  // Draw physics objects
+  // Draw the physics objects the camera can see
   auto &physics = Fumbo::Graphic2D::Physics::Instance();
-  for (const auto &obj : physics.GetObjects()) {
-    obj->Render();
-  }
+  physics.RenderVisible(camera);
 
   // Draw debug if enabled
   if (showDebug) {
-    physics.DrawDebug();
+    physics.DrawDebug(camera);
   }
 
   EndMode2D();
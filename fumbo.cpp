@@ -1,10 +1,33 @@
 #include "fumbo.hpp"
 #include "fumbo_icon.h"
 #include "raylib.h"
+#include <cmath>
+#include <cstdio>
 #include <fstream>
 #include <memory>
 #include <sstream>
 
+namespace {
+// Dirty regions kept apart before the cheapest pair is merged
+constexpr size_t MAX_CLEAN_REGIONS = 8;
+
+float RectArea(Rectangle rect) { return rect.width * rect.height; }
+
+Rectangle RectUnion(Rectangle a, Rectangle b) {
+  float left = fminf(a.x, b.x);
+  float top = fminf(a.y, b.y);
+  float right = fmaxf(a.x + a.width, b.x + b.width);
+  float bottom = fmaxf(a.y + a.height, b.y + b.height);
+  return {left, top, right - left, bottom - top};
+}
+
+// Overlapping or sharing an edge
+bool RectsTouch(Rectangle a, Rectangle b) {
+  return a.x <= b.x + b.width && b.x <= a.x + a.width &&
+         a.y <= b.y + b.height && b.y <= a.y + a.height;
+}
+} // namespace
+
 void Fumbo::Engine::Init(int width, int height, const std::string &title,
                          double targetFPS) {
 #ifndef PLATFORM_ANDROID
@@ -21,6 +44,7 @@ void Fumbo::Engine::Init(int width, int height, const std::string &title,
 
   // Initialize Shaders
   GetShaderManager().Init(width, height);
+  Utils::UpdateUITransform();
 }
 
 void Fumbo::Engine::LimitFPS(double fps) { SetTargetFPS(fps); }
@@ -41,8 +65,9 @@ void Fumbo::Engine::Cleanup() {
   GetShaderManager().Cleanup();
   GetAudioManager().Cleanup();
 
-  if (m_cleanTexture.id != 0)
-    UnloadRenderTexture(m_cleanTexture);
+  // Pooled targets still held elsewhere (buttons, effects) go with it
+  GetRenderTargetPool().Release(m_cleanTexture);
+  GetRenderTargetPool().Clear();
 
   CloseAudioDevice();
   CloseWindow();
@@ -81,6 +106,7 @@ void Fumbo::Engine::Update() {
       currentState->Cleanup();
     }
     currentState = nextState;
+    GetShaderManager().InvalidateBlurredSnapshot(); // Previous state's frame
     currentState->Init();
     InvalidateCleanLayer(); // Force redraw of clean layer for new state
     stateChangePending = false;
@@ -103,18 +129,85 @@ void Fumbo::Engine::AddGlobalOverlay(OverlayCallback cb) {
   m_globalOverlays.push_back(cb);
 }
 
-void Fumbo::Engine::Draw() {
-  // Handle Window Resize
-  if (IsWindowResized()) {
-    if (m_cleanTexture.id != 0)
-      UnloadRenderTexture(m_cleanTexture);
-    m_cleanTexture = LoadRenderTexture(GetScreenWidth(), GetScreenHeight());
+void Fumbo::Engine::InvalidateCleanRegion(Rectangle region) {
+  if (m_cleanIsInvalid)
+    return;
+
+  // Clip to UI space, padded a unit for antialiased edges
+  float left = fmaxf(region.x - 1.0f, 0.0f);
+  float top = fmaxf(region.y - 1.0f, 0.0f);
+  float right = fminf(region.x + region.width + 1.0f, Utils::UI_WIDTH);
+  float bottom = fminf(region.y + region.height + 1.0f, Utils::UI_HEIGHT);
+  if (right <= left || bottom <= top)
+    return;
+  region = {left, top, right - left, bottom - top};
+
+  auto &regions = m_cleanDirtyRegions;
+  while (true) {
+    // Absorb everything the region touches; a grown region can reach more
+    bool merged = false;
+    for (size_t i = 0; i < regions.size(); i++) {
+      if (RectsTouch(region, regions[i])) {
+        region = RectUnion(region, regions[i]);
+        regions[i] = regions.back();
+        regions.pop_back();
+        merged = true;
+        break;
+      }
+    }
+    if (merged)
+      continue;
+    if (regions.size() < MAX_CLEAN_REGIONS)
+      break;
+
+    // List full: fold into the region it grows the least
+    size_t best = 0;
+    float bestGrowth = INFINITY;
+    for (size_t i = 0; i < regions.size(); i++) {
+      float growth =
+          RectArea(RectUnion(region, regions[i])) - RectArea(regions[i]);
+      if (growth < bestGrowth) {
+        bestGrowth = growth;
+        best = i;
+      }
+    }
+    region = RectUnion(region, regions[best]);
+    regions[best] = regions.back();
+    regions.pop_back();
+  }
+  regions.push_back(region);
+
+  // Past half the screen, one full pass beats several scissored ones
+  float dirtyArea = 0.0f;
+  for (const Rectangle &dirty : regions) {
+    dirtyArea += RectArea(dirty);
+  }
+  if (dirtyArea > Utils::UI_WIDTH * Utils::UI_HEIGHT * 0.5f) {
     InvalidateCleanLayer();
   }
+}
+
+bool Fumbo::Engine::IsCleanRegionDirty(Rectangle bounds) const {
+  if (m_cleanRegionPass)
+    return CheckCollisionRecs(bounds, m_cleanActiveRegion);
+  if (m_cleanIsInvalid)
+    return true;
+  for (const Rectangle &region : m_cleanDirtyRegions) {
+    if (CheckCollisionRecs(bounds, region))
+      return true;
+  }
+  return false;
+}
 
-  // Ensure texture exists (first run)
-  if (m_cleanTexture.id == 0) {
-    m_cleanTexture = LoadRenderTexture(GetScreenWidth(), GetScreenHeight());
+void Fumbo::Engine::Draw() {
+  GetFrameAllocator().BeginFrame();
+  // Screen mapping for every draw wrapper this frame
+  Utils::UpdateUITransform();
+
+  // Match the clean layer to the window (first run and resizes); an old
+  // size goes back to the pool in case the window returns to it
+  if (GetRenderTargetPool().Resize(m_cleanTexture, GetScreenWidth(),
+                                   GetScreenHeight())) {
     InvalidateCleanLayer();
   }
 
@@ -127,6 +220,36 @@ void Fumbo::Engine::Draw() {
       currentState->DrawClean();
       EndTextureMode();
       m_cleanIsInvalid = false;
+    } else if (!m_cleanDirtyRegions.empty()) {
+      // Regions invalidated while redrawing wait for the next frame
+      m_cleanRedrawRegions.swap(m_cleanDirtyRegions);
+      m_cleanDirtyRegions.clear();
+
+      const auto &transform = Utils::GetUITransform();
+      BeginTextureMode(m_cleanTexture);
+      m_cleanRegionPass = true;
+      for (const Rectangle &region : m_cleanRedrawRegions) {
+        // Whole screen pixels covering the region
+        int left = (int)floorf(region.x * transform.scale.x +
+                               transform.offset.x);
+        int top = (int)floorf(region.y * transform.scale.y +
+                              transform.offset.y);
+        int right = (int)ceilf((region.x + region.width) * transform.scale.x +
+                               transform.offset.x);
+        int bottom = (int)ceilf(
+            (region.y + region.height) * transform.scale.y +
+            transform.offset.y);
+
+        // Pushed so widgets that clip themselves stay inside the region
+        Utils::PushScissor({(float)left, (float)top, (float)(right - left),
+                            (float)(bottom - top)});
+        ClearBackground(RAYWHITE); // Clears are scissored too
+        m_cleanActiveRegion = region;
+        currentState->DrawClean();
+        Utils::PopScissor();
+      }
+      m_cleanRegionPass = false;
+      EndTextureMode();
     }
 
     // Draw Final Frame
@@ -163,6 +286,9 @@ void Fumbo::Engine::Draw() {
 
     EndDrawing();
   }
+
+  GetRenderTargetPool().EndFrame();
+  GetFrameAllocator().EndFrame();
 }
 
 int Fumbo::Engine::GetWidth() const { return GetScreenWidth(); }
@@ -182,8 +308,9 @@ void Fumbo::Engine::DrawFPS(int x, int y) {
 
 void Fumbo::Engine::DrawFPS(int x, int y, Font font, int fontSize,
                             Color color) {
-  std::string text = std::to_string(GetFPS()) + " FPS";
-  // Or use TextFormat if strict Raylib style desired, but std::string is safer
+  // Short enough for std::string's inline buffer: no heap per frame
+  char text[16];
+  snprintf(text, sizeof(text), "%d FPS", GetFPS());
 
   Graphic2D::DrawText(text, Vector2{(float)x, (float)y}, font, fontSize, color);
 }
@@ -4,6 +4,11 @@
 #include "fumbo/pfd_wrapper.hpp" // ← clean interface, no macro pollution
 
 #include "fumbo/physics.hpp"
+#include "fumbo/sprite_batch.hpp"
+#include "fumbo/tilemap.hpp"
+#include "fumbo/command_buffer.hpp"
+#include "fumbo/frame_allocator.hpp"
+#include "fumbo/render_target_pool.hpp"
 #ifdef FUMBO_VIDEO_SUPPORT
 #include "fumbo/video.hpp"
 #endif
@@ -34,6 +39,9 @@ public:
   virtual void Resume() {}
 
   virtual void Update() = 0;
+  // Draws into the cached clean layer. Region redraws run it under a
+  // scissor: clip with Utils::PushScissor/PopScissor, which nest inside
+  // that one, never BeginScissorMode/EndScissorMode, which replace it.
   virtual void DrawClean() = 0;
   virtual void DrawDirty() = 0;
 };
@@ -299,6 +307,8 @@ namespace Graphic2D {
 // Drawing helpers
 void DrawText(const std::string &text, Vector2 basePos, Font font,
               int baseFontSize, Color color);
+void DrawText(const char *text, Vector2 basePos, Font font, int baseFontSize,
+              Color color);
 
 void DrawTexture(Texture2D texture, Vector2 basePos, Vector2 baseSize,
                  float rotation = 0.0f, Color tint = WHITE);
@@ -795,15 +805,33 @@ namespace Utils {
 constexpr float UI_WIDTH = 1280.0f;
 constexpr float UI_HEIGHT = 720.0f;
 
-// UI scale and offset
+// UI scale and offset, computed from the current screen size
 Vector2 GetUIScale();
 Vector2 GetUIOffset();
 
+// UI space -> screen mapping cached for the current frame. Engine::Draw
+// refreshes it once per frame (and on resize) so draw wrappers don't query
+// the window per call. Code running outside Engine::Draw (hit tests in
+// Update) should keep using GetUIScale/GetUIOffset.
+struct UITransform {
+  Vector2 scale = {1, 1};
+  Vector2 offset = {0, 0};
+};
+
+extern UITransform frameUITransform; // Read through GetUITransform()
+void UpdateUITransform();
+inline const UITransform &GetUITransform() { return frameUITransform; }
+
 // Coordinate helpers
 Vector2 CenterPosX(Vector2 objsize);
 Vector2 CenterPosY(Vector2 objsize);
 Vector2 CenterPosXY(Vector2 objsize);
 Rectangle UISpaceToScreen(Rectangle ui);
+
+// Nested scissor clipping (screen pixels): a push clips to its rect within
+// the enclosing one and the matching pop puts the enclosing one back.
+void PushScissor(Rectangle screenRect);
+void PopScissor();
 void DrawPixelRuler(int spacing = 50, Font font = {});
 bool MoveTowards(Vector2 &current, Vector2 target, float maxDistanceDelta);
 void Camera2DFollow(Camera2D *camera, Rectangle targetRect, float offsetx = 0,
@@ -812,6 +840,19 @@ void Camera2DFollow(Camera2D *camera, Vector2 targetCenter, float offsetx = 0,
                     float offsety = 0, float smoothness = 0.0f);
 Texture2D ColorToTexture(Color color, Vector2 resolution = {0, 0});
 
+// Visible world area of a camera, in the logical units the world helpers
+// and Graphic2D wrappers take (the UI transform is undone). Rotated cameras
+// give the bounding box of the view.
+Rectangle GetCameraWorldRect(const Camera2D &camera);
+
+// World culling for the DrawWorldSprite* helpers (and SpriteBatch's): while
+// active, sprites outside the camera view are skipped and tiled draws only
+// emit visible tiles. Call after BeginMode2D; End before drawing UI.
+void BeginWorldCulling(const Camera2D &camera);
+void EndWorldCulling();
+// False only when culling is active and rect is entirely off-screen
+bool IsWorldRectVisible(Rectangle rect);
+
 void DrawWorldSprite(const Fumbo::Graphic2D::Object *object, Texture2D texture,
                      Rectangle source, Vector2 offset = {0, 0},
                      float scale = 1.0f, Color tint = WHITE);
@@ -906,16 +947,39 @@ public:
   void Init(int width, int height);
   void Cleanup();
 
+  // Single-pass box blur shader for whatever is drawn in between; costs
+  // (2r+1)^2 taps per pixel, so prefer the blur pass for large radii
   void BeginBlurMode(float radius);
   void EndBlurMode();
 
-  // Blur Pass: Compositing multiple objects
+  // Blur Pass: Compositing multiple objects. The pass is blurred at 1/2 or
+  // 1/4 resolution with two separable Gaussian passes, then upsampled.
   void BeginBlurPass();
   void EndBlurPass(float radius, Vector2 pos = {0, 0});
 
-  // Draw content with blur shader applied
+  // Draw a texture blurred, through the same pipeline as the blur pass.
+  // This and EndBlurPass render through internal targets, so call them
+  // outside BeginTextureMode. Radii under 3 use the single-pass shader.
   void DrawBlur(Texture2D texture, Vector2 pos, float radius);
 
+  // Cached blur for static backgrounds (pause menus, dialogs): blur once,
+  // then draw a single quad per frame.
+  //   if (shaders.NeedsBlurredSnapshot(radius)) {
+  //     shaders.BeginBlurPass();
+  //     DrawFrozenScene();
+  //     shaders.CaptureBlurredSnapshot(radius); // Ends the pass
+  //   }
+  //   shaders.DrawBlurredSnapshot();
+  // True until captured, after InvalidateBlurredSnapshot(), a radius change,
+  // a different source or a window resize. Engine invalidates it on state
+  // changes. Redrawing the same source texture isn't seen; invalidate then.
+  bool NeedsBlurredSnapshot(float radius) const; // Source: the blur pass
+  bool NeedsBlurredSnapshot(Texture2D source, float radius) const;
+  void CaptureBlurredSnapshot(float radius); // From the active blur pass
+  void CaptureBlurredSnapshot(Texture2D source, float radius);
+  void InvalidateBlurredSnapshot() { snapshotValid = false; }
+  void DrawBlurredSnapshot(Vector2 pos = {0, 0}, Color tint = WHITE);
+
   FadeManager &GetFader() { return fader; }
 
 private:
@@ -930,6 +994,31 @@ private:
   RenderTexture2D blurTarget = {0};
   bool blurPassActive = false;
 
+  // Separable Gaussian blur: downsample chain (1/2, 1/4) with a ping-pong
+  // partner per level
+  static constexpr int BLUR_LEVELS = 2;
+  Shader gaussianShader = {0};
+  int locTexelStep = -1;
+  int locWeights = -1;
+  int locOffsets = -1;
+  int locTapCount = -1;
+  RenderTexture2D blurLevels[BLUR_LEVELS] = {};
+  RenderTexture2D blurScratch[BLUR_LEVELS] = {};
+
+  RenderTexture2D blurSnapshot = {0};
+  bool snapshotValid = false;
+  float snapshotRadius = 0.0f;
+  unsigned int snapshotSourceId = 0; // Texture it was captured from
+  int snapshotScreenWidth = 0; // Window size when captured
+  int snapshotScreenHeight = 0;
+
+  // Blurs source into the chain; returns the level holding the result
+  // (stored flipped, like any render texture)
+  const RenderTexture2D &GaussianBlur(Texture2D source, bool sourceFlipped,
+                                      float radius);
+  void DrawBlurred(Texture2D source, bool sourceFlipped, Vector2 pos,
+                   float radius);
+
   FadeManager fader;
 };
 
@@ -976,15 +1065,41 @@ public:
     return Audio::AudioManager::Instance();
   }
 
+  // Default physics world; other Graphic2D::Physics instances are independent
   Graphic2D::Physics &GetPhysics() { return Graphic2D::Physics::Instance(); }
 
+  // Per-frame scratch memory, reset at the start of every Draw
+  Utils::FrameAllocator &GetFrameAllocator() {
+    return Utils::FrameAllocator::Instance();
+  }
+
+  // Shared offscreen targets, recycled at the end of every Draw
+  RenderTargetPool &GetRenderTargetPool() {
+    return RenderTargetPool::Instance();
+  }
+
   // Global Accessors (Wrappers around Raylib or Utils)
   int GetWidth() const;
   int GetHeight() const;
 
   // Clean Layer Management
-  void InvalidateCleanLayer() { m_cleanIsInvalid = true; }
+  void InvalidateCleanLayer() {
+    m_cleanIsInvalid = true;
+    m_cleanDirtyRegions.clear();
+  }
   bool IsCleanLayerInvalid() const { return m_cleanIsInvalid; }
+  // Redraws only `region` (UI space) of the clean layer next frame, clipped
+  // to it with a scissor. Touching regions are merged; once they cover half
+  // the screen the whole layer is redrawn instead.
+  void InvalidateCleanRegion(Rectangle region);
+  // Pending regions (UI space); empty when nothing or everything is dirty
+  const std::vector<Rectangle> &GetDirtyCleanRegions() const {
+    return m_cleanDirtyRegions;
+  }
+  // Inside DrawClean(): whether `bounds` (UI space) overlaps the region
+  // being redrawn, so untouched widgets can be skipped. Elsewhere: whether
+  // the next redraw will cover it.
+  bool IsCleanRegionDirty(Rectangle bounds) const;
 
   // Global Overlay System
   using OverlayCallback = std::function<void()>;
@@ -1007,6 +1122,10 @@ private:
   // Clean Layer Caching
   RenderTexture2D m_cleanTexture = {0};
   bool m_cleanIsInvalid = true;
+  std::vector<Rectangle> m_cleanDirtyRegions;  // UI space, merged
+  std::vector<Rectangle> m_cleanRedrawRegions; // Being redrawn this frame
+  Rectangle m_cleanActiveRegion = {0};
+  bool m_cleanRegionPass = false; // DrawClean() runs once per region
 
   void Update();
   void Draw();
@@ -1025,6 +1144,9 @@ namespace Fumbo {
 namespace Shaders {
 void MakeSolidColor(Texture2D texture, Color color);
 Shader MakeSolidColorShader(Color color);
+// The targets below come from RenderTargetPool: give them back with
+// RenderTargetPool::Release(), not UnloadRenderTexture(). A target you
+// loaded yourself is unloaded the first time they replace it.
 Texture2D DrawMask(RenderTexture2D screen, RenderTexture2D &renderTarget,
                    Shader &maskShader, Color canvasColor = WHITE,
                    Color maskColor = BLACK, bool forceRecreate = false);
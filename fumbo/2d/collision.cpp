@@ -4,76 +4,463 @@
 #include <cmath>
 #include <limits>
 
+#if defined(__SSE__) || defined(_M_X64) ||                                     \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define FUMBO_SAT_SSE 1
+#endif
+
 namespace Fumbo {
 namespace Graphic2D {
 namespace Collision {
 
-// Main collision dispatcher
-CollisionContact CheckCollision(const Object *a, const Object *b) {
-  CollisionContact contact;
-  contact.hasCollision = false;
+namespace {
 
-  if (!a || !b)
-    return contact;
+// Per-thread scratch for world-space polygons, grown once and reused
+thread_local std::vector<Vector2> polygonScratchA;
+thread_local std::vector<Vector2> polygonScratchB;
+thread_local std::vector<PolygonView> pieceScratchA;
+thread_local std::vector<PolygonView> pieceScratchB;
 
-  // Check collision layers
-  if (!a->GetCollisionLayers().CanCollideWith(b->GetCollisionLayers())) {
-    return contact;
+// Same sine/cosine RotatePoint uses, so shapes built here match
+// Object::GetVertices() exactly
+void SinCosDegrees(float degrees, bool portable, float *sine,
+                   float *cosine) {
+  if (portable) {
+    PortableSinCos(degrees, sine, cosine);
+  } else {
+    *sine = sinf(degrees * DEG2RAD);
+    *cosine = cosf(degrees * DEG2RAD);
   }
+}
+
+// Rectangle as a 4-vertex polygon in caller storage ([0..3] vertices,
+// [4..7] normals), same corner order as GetRectangleVertices
+PolygonView RectanglePolygon(Vector2 pos, float width, float height,
+                             float rotation, bool portable,
+                             Vector2 storage[8]) {
+  float halfW = width / 2;
+  float halfH = height / 2;
+  const Vector2 corners[4] = {
+      {-halfW, -halfH}, {halfW, -halfH}, {halfW, halfH}, {-halfW, halfH}};
+  const Vector2 axes[4] = {{0, -1}, {1, 0}, {0, 1}, {-1, 0}};
 
-  ShapeType typeA = a->GetShapeType();
-  ShapeType typeB = b->GetShapeType();
+  float s = 0.0f, c = 1.0f;
+  if (rotation != 0.0f)
+    SinCosDegrees(rotation, portable, &s, &c);
 
-  // Rectangle vs Rectangle
-  if (typeA == ShapeType::Rectangle && typeB == ShapeType::Rectangle) {
-    return RectangleVsRectangle(
-        a->GetPosition(), a->GetWidth(), a->GetHeight(), a->GetRotation(),
-        b->GetPosition(), b->GetWidth(), b->GetHeight(), b->GetRotation());
+  for (int i = 0; i < 4; i++) {
+    Vector2 v = corners[i];
+    Vector2 n = axes[i];
+    storage[i] = {(v.x * c - v.y * s) + pos.x, (v.x * s + v.y * c) + pos.y};
+    storage[4 + i] = {n.x * c - n.y * s, n.x * s + n.y * c};
   }
+  return {storage, storage + 4, 4};
+}
+
+// Convex pieces of a shape in world space: one for rectangles and convex
+// polygons, several for a decomposed concave polygon
+struct PieceSet {
+  PolygonView single;
+  const PolygonView *views = nullptr;
+  int count = 0;
 
-  // Circle vs Circle
-  if (typeA == ShapeType::Circle && typeB == ShapeType::Circle) {
-    return CircleVsCircle(a->GetPosition(), a->GetRadius(), b->GetPosition(),
-                          b->GetRadius());
+  const PolygonView &operator[](int i) const {
+    return views ? views[i] : single;
+  }
+};
+
+// World-space copy of every convex piece of a polygon/triangle object.
+// Vertices and normals go to `scratch`, views to `viewScratch`; both are
+// only resized, so steady-state calls don't allocate. Matches
+// Object::GetVertices() exactly.
+void TransformPieces(const Object *object, std::vector<Vector2> &scratch,
+                     std::vector<PolygonView> &viewScratch, PieceSet &out) {
+  int pieceCount = object->GetConvexPieceCount();
+  int total = 0;
+  for (int p = 0; p < pieceCount; p++)
+    total += object->GetLocalConvexPiece(p).count;
+  scratch.resize(total * 2);
+
+  float s, c;
+  SinCosDegrees(object->GetRotation(), object->UsesPortableTrig(), &s, &c);
+  Vector2 pos = object->GetPosition();
+  float scale = object->GetScale();
+
+  Vector2 *verts = scratch.data();
+  Vector2 *normals = verts + total;
+  viewScratch.resize(pieceCount);
+  for (int p = 0; p < pieceCount; p++) {
+    PolygonView local = object->GetLocalConvexPiece(p);
+    for (int i = 0; i < local.count; i++) {
+      Vector2 v = Vector2Scale(local.vertices[i], scale);
+      verts[i] = {(v.x * c - v.y * s) + pos.x, (v.x * s + v.y * c) + pos.y};
+      Vector2 n = local.normals[i];
+      normals[i] = {n.x * c - n.y * s, n.x * s + n.y * c};
+    }
+    viewScratch[p] = {verts, normals, local.count};
+    verts += local.count;
+    normals += local.count;
   }
 
-  // Rectangle vs Circle
-  if (typeA == ShapeType::Rectangle && typeB == ShapeType::Circle) {
-    return RectangleVsCircle(a->GetPosition(), a->GetWidth(), a->GetHeight(),
-                             a->GetRotation(), b->GetPosition(),
-                             b->GetRadius());
+  out.count = pieceCount;
+  if (pieceCount == 1) {
+    out.single = viewScratch[0];
+    out.views = nullptr;
+  } else {
+    out.views = viewScratch.data();
   }
+}
 
-  // Circle vs Rectangle (swap)
-  if (typeA == ShapeType::Circle && typeB == ShapeType::Rectangle) {
-    contact =
-        RectangleVsCircle(b->GetPosition(), b->GetWidth(), b->GetHeight(),
-                          b->GetRotation(), a->GetPosition(), a->GetRadius());
-    contact.normal = Vector2Scale(contact.normal, -1.0f); // Flip normal
-    return contact;
+// Smallest projection of `verts` onto `axis`, four vertices per iteration
+// when SSE is available (same mul/add sequence as the scalar tail, so the
+// result is bit-identical either way)
+float MinProjection(const Vector2 *verts, int count, Vector2 axis) {
+  float result = std::numeric_limits<float>::max();
+  int i = 0;
+#ifdef FUMBO_SAT_SSE
+  if (count >= 4) {
+    const __m128 axisX = _mm_set1_ps(axis.x);
+    const __m128 axisY = _mm_set1_ps(axis.y);
+    __m128 lanes = _mm_set1_ps(result);
+    for (; i + 4 <= count; i += 4) {
+      const float *p = &verts[i].x;
+      __m128 v01 = _mm_loadu_ps(p);     // x0 y0 x1 y1
+      __m128 v23 = _mm_loadu_ps(p + 4); // x2 y2 x3 y3
+      __m128 xs = _mm_shuffle_ps(v01, v23, _MM_SHUFFLE(2, 0, 2, 0));
+      __m128 ys = _mm_shuffle_ps(v01, v23, _MM_SHUFFLE(3, 1, 3, 1));
+      __m128 proj =
+          _mm_add_ps(_mm_mul_ps(xs, axisX), _mm_mul_ps(ys, axisY));
+      lanes = _mm_min_ps(lanes, proj);
+    }
+    lanes = _mm_min_ps(lanes, _mm_shuffle_ps(lanes, lanes,
+                                             _MM_SHUFFLE(1, 0, 3, 2)));
+    lanes = _mm_min_ps(lanes, _mm_shuffle_ps(lanes, lanes,
+                                             _MM_SHUFFLE(2, 3, 0, 1)));
+    result = _mm_cvtss_f32(lanes);
+  }
+#endif
+  for (; i < count; i++) {
+    result = fminf(result, verts[i].x * axis.x + verts[i].y * axis.y);
+  }
+  return result;
+}
+
+// Separation of `other` from face `face` of `poly` (positive = apart)
+float FaceSeparation(const PolygonView &poly, int face,
+                     const PolygonView &other) {
+  Vector2 normal = poly.normals[face];
+  return MinProjection(other.vertices, other.count, normal) -
+         Vector2DotProduct(normal, poly.vertices[face]);
+}
+
+// Face of `poly` with the largest separation from `other`. Stops at the
+// first separating face since any one is enough to reject the pair.
+float FindMaxSeparation(const PolygonView &poly, const PolygonView &other,
+                        int *bestFace) {
+  float best = std::numeric_limits<float>::lowest();
+  *bestFace = 0;
+  for (int i = 0; i < poly.count; i++) {
+    Vector2 normal = poly.normals[i];
+    if (normal.x == 0.0f && normal.y == 0.0f)
+      continue; // Degenerate edge
+
+    float separation = FaceSeparation(poly, i, other);
+    if (separation > best) {
+      best = separation;
+      *bestFace = i;
+      if (separation > 0.0f)
+        break;
+    }
+  }
+  return best;
+}
+
+// Closest points between segments p1-q1 and p2-q2 (Ericson, RTCD 5.1.9)
+void ClosestPointsOnSegments(Vector2 p1, Vector2 q1, Vector2 p2, Vector2 q2,
+                             Vector2 *c1, Vector2 *c2) {
+  const float epsilon = 1e-8f;
+  Vector2 d1 = Vector2Subtract(q1, p1);
+  Vector2 d2 = Vector2Subtract(q2, p2);
+  Vector2 r = Vector2Subtract(p1, p2);
+  float a = Vector2DotProduct(d1, d1);
+  float e = Vector2DotProduct(d2, d2);
+  float f = Vector2DotProduct(d2, r);
+  float s = 0.0f, t = 0.0f;
+
+  if (a <= epsilon && e <= epsilon) {
+    // Both degenerate to points
+  } else if (a <= epsilon) {
+    t = Clamp(f / e, 0.0f, 1.0f);
+  } else {
+    float c = Vector2DotProduct(d1, r);
+    if (e <= epsilon) {
+      s = Clamp(-c / a, 0.0f, 1.0f);
+    } else {
+      float b = Vector2DotProduct(d1, d2);
+      float denom = a * e - b * b;
+      s = denom != 0.0f ? Clamp((b * f - c * e) / denom, 0.0f, 1.0f) : 0.0f;
+      t = (b * s + f) / e;
+      if (t < 0.0f) {
+        t = 0.0f;
+        s = Clamp(-c / a, 0.0f, 1.0f);
+      } else if (t > 1.0f) {
+        t = 1.0f;
+        s = Clamp((b - c) / a, 0.0f, 1.0f);
+      }
+    }
+  }
+
+  *c1 = Vector2Add(p1, Vector2Scale(d1, s));
+  *c2 = Vector2Add(p2, Vector2Scale(d2, t));
+}
+
+// Keep the part of segment `points` where dot(normal, p) <= offset
+bool ClipSegment(Vector2 points[2], Vector2 normal, float offset) {
+  float d0 = Vector2DotProduct(normal, points[0]) - offset;
+  float d1 = Vector2DotProduct(normal, points[1]) - offset;
+  if (d0 > 0.0f && d1 > 0.0f)
+    return false;
+  if (d0 > 0.0f) {
+    points[0] = Vector2Lerp(points[0], points[1], d0 / (d0 - d1));
+  } else if (d1 > 0.0f) {
+    points[1] = Vector2Lerp(points[1], points[0], d1 / (d1 - d0));
+  }
+  return true;
+}
+
+} // namespace
+
+// ===== Dispatch =====
+// One entry per ShapeType pair. Rectangles become 4-vertex polygons on the
+// stack, polygons/triangles use the per-thread scratch (one view per convex
+// piece), and lines are capsules (segment inflated by half the line
+// thickness).
+
+namespace {
+
+using CollideFn = CollisionContact (*)(const Object *, const Object *, int *);
+
+// Runs `Fn` with the operands swapped and flips the normal back to A->B
+template <CollideFn Fn>
+CollisionContact Swapped(const Object *a, const Object *b, int *axisHint) {
+  CollisionContact contact = Fn(b, a, axisHint);
+  contact.normal = Vector2Negate(contact.normal);
+  return contact;
+}
+
+PolygonView AsRectangle(const Object *object, Vector2 storage[8]) {
+  float scale = object->GetScale();
+  return RectanglePolygon(object->GetPosition(), object->GetWidth() * scale,
+                          object->GetHeight() * scale, object->GetRotation(),
+                          object->UsesPortableTrig(), storage);
+}
+
+void AsPieces(const Object *object, Vector2 rectStorage[8],
+              std::vector<Vector2> &scratch,
+              std::vector<PolygonView> &viewScratch, PieceSet &out) {
+  if (object->GetShapeType() == ShapeType::Rectangle) {
+    out.single = AsRectangle(object, rectStorage);
+    out.views = nullptr;
+    out.count = 1;
+    return;
+  }
+  TransformPieces(object, scratch, viewScratch, out);
+}
+
+// Concave shapes report their deepest piece contact
+void KeepDeepest(CollisionContact &best, const CollisionContact &contact) {
+  if (contact.hasCollision &&
+      (!best.hasCollision || contact.penetration > best.penetration)) {
+    best = contact;
+  }
+}
+
+float ScaledRadius(const Object *object) {
+  return object->GetRadius() * object->GetScale();
+}
+
+float LineRadius(const Object *line) { return line->GetThickness() * 0.5f; }
+
+Vector2 LineStart(const Object *line) {
+  return Vector2Add(line->GetPosition(), line->GetLineStart());
+}
+
+Vector2 LineEnd(const Object *line) {
+  return Vector2Add(line->GetPosition(), line->GetLineEnd());
+}
+
+CollisionContact CollideRectangles(const Object *a, const Object *b,
+                                   int *axisHint) {
+  if (a->GetRotation() == 0.0f && b->GetRotation() == 0.0f) {
+    float scaleA = a->GetScale();
+    float scaleB = b->GetScale();
+    return RectangleVsRectangle(a->GetPosition(), a->GetWidth() * scaleA,
+                                a->GetHeight() * scaleA, 0.0f,
+                                b->GetPosition(), b->GetWidth() * scaleB,
+                                b->GetHeight() * scaleB, 0.0f);
   }
+  Vector2 storageA[8], storageB[8];
+  return PolygonVsPolygon(AsRectangle(a, storageA), AsRectangle(b, storageB),
+                          axisHint);
+}
+
+CollisionContact CollideCircles(const Object *a, const Object *b, int *) {
+  return CircleVsCircle(a->GetPosition(), ScaledRadius(a), b->GetPosition(),
+                        ScaledRadius(b));
+}
 
-  // Polygon/Triangle vs Polygon/Triangle
-  if ((typeA == ShapeType::Polygon || typeA == ShapeType::Triangle) &&
-      (typeB == ShapeType::Polygon || typeB == ShapeType::Triangle)) {
-    return PolygonVsPolygon(a->GetVertices(), b->GetVertices());
+CollisionContact CollidePolygons(const Object *a, const Object *b,
+                                 int *axisHint) {
+  Vector2 storageA[8], storageB[8];
+  PieceSet piecesA, piecesB;
+  AsPieces(a, storageA, polygonScratchA, pieceScratchA, piecesA);
+  AsPieces(b, storageB, polygonScratchB, pieceScratchB, piecesB);
+  if (piecesA.count == 1 && piecesB.count == 1)
+    return PolygonVsPolygon(piecesA[0], piecesB[0], axisHint);
+
+  // The axis hint only makes sense for a single piece pair
+  CollisionContact contact;
+  contact.hasCollision = false;
+  for (int i = 0; i < piecesA.count; i++) {
+    for (int j = 0; j < piecesB.count; j++) {
+      KeepDeepest(contact, PolygonVsPolygon(piecesA[i], piecesB[j]));
+    }
   }
+  return contact;
+}
 
-  // Polygon vs Circle
-  if ((typeA == ShapeType::Polygon || typeA == ShapeType::Triangle) &&
-      typeB == ShapeType::Circle) {
-    return PolygonVsCircle(a->GetVertices(), b->GetPosition(), b->GetRadius());
+CollisionContact CollidePolygonCircle(const Object *a, const Object *b,
+                                      int *) {
+  Vector2 storage[8];
+  PieceSet pieces;
+  AsPieces(a, storage, polygonScratchA, pieceScratchA, pieces);
+
+  CollisionContact contact;
+  contact.hasCollision = false;
+  for (int i = 0; i < pieces.count; i++) {
+    KeepDeepest(contact, PolygonVsCircle(pieces[i], b->GetPosition(),
+                                         ScaledRadius(b)));
   }
+  return contact;
+}
 
-  // Circle vs Polygon (swap)
-  if (typeA == ShapeType::Circle &&
-      (typeB == ShapeType::Polygon || typeB == ShapeType::Triangle)) {
-    contact =
-        PolygonVsCircle(b->GetVertices(), a->GetPosition(), a->GetRadius());
-    contact.normal = Vector2Scale(contact.normal, -1.0f);
+CollisionContact CollideLineCircle(const Object *a, const Object *b, int *) {
+  return SegmentVsCircle(LineStart(a), LineEnd(a), LineRadius(a),
+                         b->GetPosition(), ScaledRadius(b));
+}
+
+CollisionContact CollideLinePolygon(const Object *a, const Object *b, int *) {
+  Vector2 storage[8];
+  PieceSet pieces;
+  AsPieces(b, storage, polygonScratchB, pieceScratchB, pieces);
+
+  CollisionContact contact;
+  contact.hasCollision = false;
+  for (int i = 0; i < pieces.count; i++) {
+    KeepDeepest(contact, SegmentVsPolygon(LineStart(a), LineEnd(a),
+                                          LineRadius(a), pieces[i]));
+  }
+  return contact;
+}
+
+CollisionContact CollideLines(const Object *a, const Object *b, int *) {
+  return SegmentVsSegment(LineStart(a), LineEnd(a), LineRadius(a),
+                          LineStart(b), LineEnd(b), LineRadius(b));
+}
+
+constexpr int SHAPE_TYPE_COUNT = 5;
+
+// Indexed [typeA][typeB] in ShapeType order (rectangle-circle goes through
+// the polygon path, which also handles a center inside the rectangle):
+// Rectangle, Circle, Triangle, Polygon, Line
+const CollideFn collideTable[SHAPE_TYPE_COUNT][SHAPE_TYPE_COUNT] = {
+    {CollideRectangles, CollidePolygonCircle, CollidePolygons,
+     CollidePolygons, Swapped<CollideLinePolygon>},
+    {Swapped<CollidePolygonCircle>, CollideCircles,
+     Swapped<CollidePolygonCircle>, Swapped<CollidePolygonCircle>,
+     Swapped<CollideLineCircle>},
+    {CollidePolygons, CollidePolygonCircle, CollidePolygons, CollidePolygons,
+     Swapped<CollideLinePolygon>},
+    {CollidePolygons, CollidePolygonCircle, CollidePolygons, CollidePolygons,
+     Swapped<CollideLinePolygon>},
+    {CollideLinePolygon, CollideLineCircle, CollideLinePolygon,
+     CollideLinePolygon, CollideLines},
+};
+
+// Stand-in shapes for added fixtures, reused between calls
+thread_local Object fixtureShapes[2 * Object::MAX_FIXTURES];
+
+} // namespace
+
+// Own shapes only, ignoring fixtures
+CollisionContact CheckShapeCollision(const Object *a, const Object *b,
+                                     int *axisHint) {
+  CollisionContact contact;
+  contact.hasCollision = false;
+
+  if (!a || !b)
     return contact;
+
+  // Check collision layers
+  if (!a->GetCollisionLayers().CanCollideWith(b->GetCollisionLayers())) {
+    return contact;
+  }
+
+  int typeA = static_cast<int>(a->GetShapeType());
+  int typeB = static_cast<int>(b->GetShapeType());
+  contact = collideTable[typeA][typeB](a, b, axisHint);
+
+  // Every contact carries at least one manifold point
+  if (contact.hasCollision && contact.pointCount == 0) {
+    contact.points[0] = contact.point;
+    contact.depths[0] = contact.penetration;
+    contact.pointCount = 1;
+  }
+  return contact;
+}
+
+// Main collision dispatcher
+CollisionContact CheckCollision(const Object *a, const Object *b,
+                                int *axisHint) {
+  if (!a || !b || (a->GetFixtureCount() == 1 && b->GetFixtureCount() == 1))
+    return CheckShapeCollision(a, b, axisHint);
+
+  // Compound: every fixture pair, keeping the deepest contact and
+  // preferring solid pairs over trigger pairs
+  const Object *shapesA[1 + Object::MAX_FIXTURES] = {a};
+  const Object *shapesB[1 + Object::MAX_FIXTURES] = {b};
+  for (int i = 1; i < a->GetFixtureCount(); i++) {
+    a->MakeFixtureShape(i, fixtureShapes[i - 1]);
+    shapesA[i] = &fixtureShapes[i - 1];
+  }
+  for (int j = 1; j < b->GetFixtureCount(); j++) {
+    b->MakeFixtureShape(j, fixtureShapes[Object::MAX_FIXTURES + j - 1]);
+    shapesB[j] = &fixtureShapes[Object::MAX_FIXTURES + j - 1];
   }
 
+  CollisionContact contact;
+  contact.hasCollision = false;
+  bool contactSolid = false;
+  for (int i = 0; i < a->GetFixtureCount(); i++) {
+    for (int j = 0; j < b->GetFixtureCount(); j++) {
+      // The SAT hint belongs to the own-shape pair
+      CollisionContact candidate = CheckShapeCollision(
+          shapesA[i], shapesB[j], (i == 0 && j == 0) ? axisHint : nullptr);
+      if (!candidate.hasCollision)
+        continue;
+
+      candidate.fixtureA = i;
+      candidate.fixtureB = j;
+      bool solid = !a->IsFixtureTrigger(i) && !b->IsFixtureTrigger(j);
+      if (!contact.hasCollision || (solid && !contactSolid) ||
+          (solid == contactSolid &&
+           candidate.penetration > contact.penetration)) {
+        contact = candidate;
+        contactSolid = solid;
+      }
+    }
+  }
   return contact;
 }
 
@@ -99,23 +486,38 @@ CollisionContact RectangleVsRectangle(Vector2 posA, float widthA, float heightA,
       float overlapX = (widthA + widthB) / 2 - fabsf(delta.x);
       float overlapY = (heightA + heightB) / 2 - fabsf(delta.y);
 
+      // Manifold like the polygon path: the two ends of the overlap along
+      // the touching face, midway through the penetration. A single
+      // center point would spin any box resting off the other's center.
+      float left = fmaxf(rectA.x, rectB.x);
+      float right = fminf(rectA.x + widthA, rectB.x + widthB);
+      float top = fmaxf(rectA.y, rectB.y);
+      float bottom = fminf(rectA.y + heightA, rectB.y + heightB);
+      float midX = (left + right) * 0.5f;
+      float midY = (top + bottom) * 0.5f;
+
       if (overlapX < overlapY) {
         contact.penetration = overlapX;
         contact.normal = {delta.x > 0 ? 1.0f : -1.0f, 0.0f};
+        contact.points[0] = {midX, top};
+        contact.points[1] = {midX, bottom};
       } else {
         contact.penetration = overlapY;
         contact.normal = {0.0f, delta.y > 0 ? 1.0f : -1.0f};
+        contact.points[0] = {left, midY};
+        contact.points[1] = {right, midY};
       }
-
-      contact.point = Vector2Add(posA, Vector2Scale(delta, 0.5f));
+      contact.depths[0] = contact.depths[1] = contact.penetration;
+      contact.pointCount =
+          Vector2Equals(contact.points[0], contact.points[1]) ? 1 : 2;
+      contact.point = {midX, midY};
     }
   } else {
     // Use SAT for rotated rectangles
-    std::vector<Vector2> vertsA =
-        GetRectangleVertices(posA, widthA, heightA, rotA);
-    std::vector<Vector2> vertsB =
-        GetRectangleVertices(posB, widthB, heightB, rotB);
-    contact = PolygonVsPolygon(vertsA, vertsB);
+    Vector2 storageA[8], storageB[8];
+    contact = PolygonVsPolygon(
+        RectanglePolygon(posA, widthA, heightA, rotA, false, storageA),
+        RectanglePolygon(posB, widthB, heightB, rotB, false, storageB));
   }
 
   return contact;
@@ -200,142 +602,438 @@ CollisionContact RectangleVsCircle(Vector2 rectPos, float width, float height,
 }
 
 // Polygon vs Polygon collision using SAT (Separating Axis Theorem)
-CollisionContact PolygonVsPolygon(const std::vector<Vector2> &vertsA,
-                                  const std::vector<Vector2> &vertsB) {
+CollisionContact PolygonVsPolygon(const PolygonView &a, const PolygonView &b,
+                                  int *axisHint) {
   CollisionContact contact;
   contact.hasCollision = false;
 
-  if (vertsA.size() < 3 || vertsB.size() < 3)
+  if (a.count < 3 || b.count < 3)
     return contact;
 
-  float minPenetration = std::numeric_limits<float>::max();
-  Vector2 collisionNormal = {0, 0};
-
-  // Test all axes from both polygons
-  auto testAxes = [&](const std::vector<Vector2> &verts,
-                      const std::vector<Vector2> &other) -> bool {
-    for (size_t i = 0; i < verts.size(); i++) {
-      Vector2 p1 = verts[i];
-      Vector2 p2 = verts[(i + 1) % verts.size()];
-      Vector2 edge = Vector2Subtract(p2, p1);
-      Vector2 axis = Vector2Normalize({-edge.y, edge.x}); // Perpendicular
-
-      // Project both polygons onto axis
-      float minA = std::numeric_limits<float>::max();
-      float maxA = std::numeric_limits<float>::lowest();
-      for (const auto &v : verts) {
-        float proj = Vector2DotProduct(v, axis);
-        minA = fminf(minA, proj);
-        maxA = fmaxf(maxA, proj);
-      }
+  // Axes are numbered A's faces first, then B's
+  int hint = axisHint ? *axisHint : -1;
+  if (hint >= 0 && hint < a.count + b.count) {
+    float separation = hint < a.count
+                           ? FaceSeparation(a, hint, b)
+                           : FaceSeparation(b, hint - a.count, a);
+    if (separation > 0.0f)
+      return contact; // Still apart along last step's axis
+  }
 
-      float minB = std::numeric_limits<float>::max();
-      float maxB = std::numeric_limits<float>::lowest();
-      for (const auto &v : other) {
-        float proj = Vector2DotProduct(v, axis);
-        minB = fminf(minB, proj);
-        maxB = fmaxf(maxB, proj);
-      }
+  int faceA, faceB;
+  float separationA = FindMaxSeparation(a, b, &faceA);
+  if (separationA > 0.0f) {
+    if (axisHint)
+      *axisHint = faceA;
+    return contact;
+  }
+  float separationB = FindMaxSeparation(b, a, &faceB);
+  if (separationB > 0.0f) {
+    if (axisHint)
+      *axisHint = a.count + faceB;
+    return contact;
+  }
 
-      // Check for separation
-      if (maxA < minB || maxB < minA) {
-        return false; // Separating axis found
-      }
+  // Reference face: prefer A's unless B's is clearly shallower, so the
+  // choice doesn't flicker between nearly equal faces
+  const float referenceBias = 0.001f;
+  bool flip = separationB > separationA + referenceBias;
+  const PolygonView &ref = flip ? b : a;
+  const PolygonView &inc = flip ? a : b;
+  int refFace = flip ? faceB : faceA;
+  if (axisHint)
+    *axisHint = flip ? a.count + faceB : faceA;
+
+  Vector2 refNormal = ref.normals[refFace];
+  Vector2 v1 = ref.vertices[refFace];
+  Vector2 v2 = ref.vertices[(refFace + 1) % ref.count];
+
+  // Incident face: the one most anti-parallel to the reference normal
+  int incFace = 0;
+  float minDot = std::numeric_limits<float>::max();
+  for (int i = 0; i < inc.count; i++) {
+    float d = Vector2DotProduct(refNormal, inc.normals[i]);
+    if (d < minDot) {
+      minDot = d;
+      incFace = i;
+    }
+  }
 
-      // Calculate penetration
-      float penetration = fminf(maxA - minB, maxB - minA);
-      if (penetration < minPenetration) {
-        minPenetration = penetration;
-        collisionNormal = axis;
-      }
+  // Clip the incident edge to the reference face's side planes
+  Vector2 clipped[2] = {inc.vertices[incFace],
+                        inc.vertices[(incFace + 1) % inc.count]};
+  Vector2 tangent = Vector2Normalize(Vector2Subtract(v2, v1));
+  bool clipOk =
+      ClipSegment(clipped, Vector2Negate(tangent),
+                  -Vector2DotProduct(tangent, v1)) &&
+      ClipSegment(clipped, tangent, Vector2DotProduct(tangent, v2));
+
+  // Keep clipped points behind the reference face, placed midway between
+  // the two surfaces
+  float refOffset = Vector2DotProduct(refNormal, v1);
+  contact.pointCount = 0;
+  for (int i = 0; clipOk && i < 2; i++) {
+    float separation = Vector2DotProduct(refNormal, clipped[i]) - refOffset;
+    if (separation <= 0.0f) {
+      contact.depths[contact.pointCount] = -separation;
+      contact.points[contact.pointCount++] = Vector2Subtract(
+          clipped[i], Vector2Scale(refNormal, separation * 0.5f));
     }
-    return true;
-  };
+  }
 
-  if (!testAxes(vertsA, vertsB) || !testAxes(vertsB, vertsA)) {
-    return contact;
+  if (contact.pointCount == 0) {
+    // Numerical corner case: fall back to the deepest incident vertex
+    int deepest = 0;
+    for (int i = 1; i < inc.count; i++) {
+      if (Vector2DotProduct(refNormal, inc.vertices[i]) <
+          Vector2DotProduct(refNormal, inc.vertices[deepest])) {
+        deepest = i;
+      }
+    }
+    contact.points[0] = inc.vertices[deepest];
+    contact.depths[0] = -(flip ? separationB : separationA);
+    contact.pointCount = 1;
   }
 
-  // Collision detected
   contact.hasCollision = true;
-  contact.penetration = minPenetration;
-  contact.normal = collisionNormal;
-
-  // Calculate contact point (average of overlapping vertices)
-  Vector2 contactSum = {0, 0};
-  int contactCount = 0;
-  for (const auto &v : vertsA) {
-    // Simple heuristic: vertices of A inside B's bounds
-    Rectangle boundsB = GetBoundingBox(vertsB);
-    if (CheckCollisionPointRec(v, boundsB)) {
-      contactSum = Vector2Add(contactSum, v);
-      contactCount++;
+  contact.penetration = -(flip ? separationB : separationA);
+  contact.normal = flip ? Vector2Negate(refNormal) : refNormal;
+  contact.point = contact.pointCount == 2
+                      ? Vector2Lerp(contact.points[0], contact.points[1], 0.5f)
+                      : contact.points[0];
+
+  return contact;
+}
+
+CollisionContact PolygonVsPolygon(const std::vector<Vector2> &vertsA,
+                                  const std::vector<Vector2> &vertsB) {
+  std::vector<Vector2> normalsA(vertsA.size());
+  std::vector<Vector2> normalsB(vertsB.size());
+  ComputeEdgeNormals(vertsA.data(), (int)vertsA.size(), normalsA.data());
+  ComputeEdgeNormals(vertsB.data(), (int)vertsB.size(), normalsB.data());
+  return PolygonVsPolygon(
+      PolygonView{vertsA.data(), normalsA.data(), (int)vertsA.size()},
+      PolygonView{vertsB.data(), normalsB.data(), (int)vertsB.size()});
+}
+
+// Polygon vs Circle collision: deepest face first, then the edge's
+// vertex regions when the center is outside
+CollisionContact PolygonVsCircle(const PolygonView &poly, Vector2 circlePos,
+                                 float radius) {
+  CollisionContact contact;
+  contact.hasCollision = false;
+
+  if (poly.count < 3)
+    return contact;
+
+  int face = 0;
+  float separation = std::numeric_limits<float>::lowest();
+  for (int i = 0; i < poly.count; i++) {
+    Vector2 normal = poly.normals[i];
+    if (normal.x == 0.0f && normal.y == 0.0f)
+      continue; // Degenerate edge
+
+    float s = Vector2DotProduct(
+        normal, Vector2Subtract(circlePos, poly.vertices[i]));
+    if (s > radius)
+      return contact; // Separating axis found
+    if (s > separation) {
+      separation = s;
+      face = i;
     }
   }
-  if (contactCount > 0) {
-    contact.point = Vector2Scale(contactSum, 1.0f / contactCount);
+
+  Vector2 v1 = poly.vertices[face];
+  Vector2 v2 = poly.vertices[(face + 1) % poly.count];
+  Vector2 faceNormal = poly.normals[face];
+
+  if (separation <= 0.0f) {
+    // Center inside the polygon: push out through the shallowest face
+    contact.hasCollision = true;
+    contact.normal = faceNormal;
+    contact.penetration = radius - separation;
+    contact.point =
+        Vector2Subtract(circlePos, Vector2Scale(faceNormal, separation));
+    return contact;
+  }
+
+  // Closest feature of that face: either end vertex or the face itself
+  Vector2 closest;
+  if (Vector2DotProduct(Vector2Subtract(circlePos, v1),
+                        Vector2Subtract(v2, v1)) <= 0.0f) {
+    closest = v1;
+  } else if (Vector2DotProduct(Vector2Subtract(circlePos, v2),
+                               Vector2Subtract(v1, v2)) <= 0.0f) {
+    closest = v2;
+  } else {
+    closest =
+        Vector2Subtract(circlePos, Vector2Scale(faceNormal, separation));
   }
 
+  Vector2 delta = Vector2Subtract(circlePos, closest);
+  float distSq = Vector2DotProduct(delta, delta);
+  if (distSq >= radius * radius)
+    return contact;
+
+  float dist = sqrtf(distSq);
+  contact.hasCollision = true;
+  contact.normal = dist > 0.0001f ? Vector2Scale(delta, 1.0f / dist)
+                                  : faceNormal;
+  contact.penetration = radius - dist;
+  contact.point = closest;
   return contact;
 }
 
-// Polygon vs Circle collision
 CollisionContact PolygonVsCircle(const std::vector<Vector2> &verts,
                                  Vector2 circlePos, float radius) {
+  std::vector<Vector2> normals(verts.size());
+  ComputeEdgeNormals(verts.data(), (int)verts.size(), normals.data());
+  return PolygonVsCircle(
+      PolygonView{verts.data(), normals.data(), (int)verts.size()},
+      circlePos, radius);
+}
+
+// Capsule (segment start-end inflated by segmentRadius) vs Circle
+CollisionContact SegmentVsCircle(Vector2 start, Vector2 end,
+                                 float segmentRadius, Vector2 circlePos,
+                                 float radius) {
   CollisionContact contact;
   contact.hasCollision = false;
 
-  if (verts.size() < 3)
-    return contact;
+  Vector2 closest, unused;
+  ClosestPointsOnSegments(start, end, circlePos, circlePos, &closest, &unused);
 
-  // Find closest edge to circle
-  float minDistSq = std::numeric_limits<float>::max();
-  Vector2 closestPoint = {0, 0};
+  Vector2 delta = Vector2Subtract(circlePos, closest);
+  float distSq = Vector2DotProduct(delta, delta);
+  float radiusSum = segmentRadius + radius;
+  if (distSq >= radiusSum * radiusSum)
+    return contact;
 
-  for (size_t i = 0; i < verts.size(); i++) {
-    Vector2 p1 = verts[i];
-    Vector2 p2 = verts[(i + 1) % verts.size()];
+  float dist = sqrtf(distSq);
+  contact.hasCollision = true;
+  if (dist > 0.0001f) {
+    contact.normal = Vector2Scale(delta, 1.0f / dist);
+  } else {
+    // Center on the segment: push out along the segment's normal
+    Vector2 edge = Vector2Normalize(Vector2Subtract(end, start));
+    contact.normal = {-edge.y, edge.x};
+    if (contact.normal.x == 0.0f && contact.normal.y == 0.0f)
+      contact.normal = {0.0f, -1.0f};
+  }
+  contact.penetration = radiusSum - dist;
+  contact.point = Vector2Add(closest, Vector2Scale(contact.normal,
+                                                   segmentRadius));
+  return contact;
+}
 
-    // Find closest point on edge to circle center
-    Vector2 edge = Vector2Subtract(p2, p1);
-    Vector2 toCircle = Vector2Subtract(circlePos, p1);
-    float edgeLengthSq = Vector2DotProduct(edge, edge);
-    float t = Vector2DotProduct(toCircle, edge) / edgeLengthSq;
-    t = fmaxf(0.0f, fminf(1.0f, t));
+// Capsule vs convex polygon: SAT on the bare segment, then exact distance
+// when the segment is outside but within its radius (rounded caps)
+CollisionContact SegmentVsPolygon(Vector2 start, Vector2 end,
+                                  float segmentRadius,
+                                  const PolygonView &poly) {
+  CollisionContact contact;
+  contact.hasCollision = false;
 
-    Vector2 pointOnEdge = Vector2Add(p1, Vector2Scale(edge, t));
-    Vector2 delta = Vector2Subtract(circlePos, pointOnEdge);
-    float distSq = Vector2DotProduct(delta, delta);
+  if (poly.count < 3)
+    return contact;
 
-    if (distSq < minDistSq) {
-      minDistSq = distSq;
-      closestPoint = pointOnEdge;
+  float maxSeparation = std::numeric_limits<float>::lowest();
+  Vector2 normal = {0.0f, -1.0f}; // From the segment towards the polygon
+  Vector2 point = start;
+
+  // Polygon faces
+  for (int i = 0; i < poly.count; i++) {
+    Vector2 n = poly.normals[i];
+    if (n.x == 0.0f && n.y == 0.0f)
+      continue;
+
+    float offset = Vector2DotProduct(n, poly.vertices[i]);
+    float dStart = Vector2DotProduct(n, start);
+    float dEnd = Vector2DotProduct(n, end);
+    float separation = fminf(dStart, dEnd) - offset;
+    if (separation > segmentRadius)
+      return contact;
+    if (separation > maxSeparation) {
+      maxSeparation = separation;
+      normal = Vector2Negate(n);
+      point = dStart <= dEnd ? start : end;
     }
   }
 
-  // Check if circle overlaps
-  if (minDistSq < radius * radius) {
-    contact.hasCollision = true;
-    float dist = sqrtf(minDistSq);
-    Vector2 delta = Vector2Subtract(circlePos, closestPoint);
+  // Segment normal, both sides
+  Vector2 edge = Vector2Subtract(end, start);
+  float length = Vector2Length(edge);
+  if (length > 0.0f) {
+    Vector2 axis = {-edge.y / length, edge.x / length};
+    float offset = Vector2DotProduct(axis, start);
+    int minIndex = 0, maxIndex = 0;
+    float minProj = std::numeric_limits<float>::max();
+    float maxProj = std::numeric_limits<float>::lowest();
+    for (int i = 0; i < poly.count; i++) {
+      float proj = Vector2DotProduct(axis, poly.vertices[i]);
+      if (proj < minProj) {
+        minProj = proj;
+        minIndex = i;
+      }
+      if (proj > maxProj) {
+        maxProj = proj;
+        maxIndex = i;
+      }
+    }
 
-    if (dist > 0.0001f) {
-      contact.normal = Vector2Scale(delta, 1.0f / dist);
-    } else {
-      contact.normal = {0.0f, 1.0f};
+    float above = minProj - offset; // Polygon on the +axis side
+    float below = offset - maxProj; // Polygon on the -axis side
+    if (fmaxf(above, below) > segmentRadius)
+      return contact;
+    if (above > maxSeparation) {
+      maxSeparation = above;
+      normal = axis;
+      point = poly.vertices[minIndex];
+    }
+    if (below > maxSeparation) {
+      maxSeparation = below;
+      normal = Vector2Negate(axis);
+      point = poly.vertices[maxIndex];
     }
+  }
 
-    contact.penetration = radius - dist;
-    contact.point = closestPoint;
+  if (maxSeparation > 0.0f) {
+    // Bare segment is outside: use the true distance to the nearest edge
+    float bestDistSq = std::numeric_limits<float>::max();
+    Vector2 onSegment = start, onPolygon = start;
+    for (int i = 0; i < poly.count; i++) {
+      Vector2 c1, c2;
+      ClosestPointsOnSegments(start, end, poly.vertices[i],
+                              poly.vertices[(i + 1) % poly.count], &c1, &c2);
+      Vector2 delta = Vector2Subtract(c2, c1);
+      float distSq = Vector2DotProduct(delta, delta);
+      if (distSq < bestDistSq) {
+        bestDistSq = distSq;
+        onSegment = c1;
+        onPolygon = c2;
+      }
+    }
+    if (bestDistSq >= segmentRadius * segmentRadius)
+      return contact;
+
+    float dist = sqrtf(bestDistSq);
+    contact.hasCollision = true;
+    contact.normal = dist > 0.0001f
+                         ? Vector2Scale(Vector2Subtract(onPolygon, onSegment),
+                                        1.0f / dist)
+                         : normal;
+    contact.penetration = segmentRadius - dist;
+    contact.point = onPolygon;
+    return contact;
   }
 
+  contact.hasCollision = true;
+  contact.normal = normal;
+  contact.penetration = segmentRadius - maxSeparation;
+  contact.point = point;
   return contact;
 }
 
+// Capsule vs Capsule
+CollisionContact SegmentVsSegment(Vector2 startA, Vector2 endA, float radiusA,
+                                  Vector2 startB, Vector2 endB,
+                                  float radiusB) {
+  CollisionContact contact;
+  contact.hasCollision = false;
+
+  Vector2 c1, c2;
+  ClosestPointsOnSegments(startA, endA, startB, endB, &c1, &c2);
+
+  Vector2 delta = Vector2Subtract(c2, c1);
+  float distSq = Vector2DotProduct(delta, delta);
+  float radiusSum = radiusA + radiusB;
+  if (distSq >= radiusSum * radiusSum)
+    return contact;
+
+  float dist = sqrtf(distSq);
+  contact.hasCollision = true;
+  if (dist > 0.0001f) {
+    contact.normal = Vector2Scale(delta, 1.0f / dist);
+  } else {
+    // Crossing segments: A's normal, facing B's midpoint
+    Vector2 edge = Vector2Normalize(Vector2Subtract(endA, startA));
+    contact.normal = {-edge.y, edge.x};
+    if (contact.normal.x == 0.0f && contact.normal.y == 0.0f)
+      contact.normal = {0.0f, -1.0f};
+    Vector2 toB = Vector2Subtract(Vector2Lerp(startB, endB, 0.5f), c1);
+    if (Vector2DotProduct(toB, contact.normal) < 0.0f)
+      contact.normal = Vector2Negate(contact.normal);
+  }
+  contact.penetration = radiusSum - dist;
+  contact.point = Vector2Lerp(c1, c2, 0.5f);
+  return contact;
+}
+
+// Portable trig table
+
+namespace {
+
+// Entries per full turn (power of two so wrapping is a mask)
+constexpr int TRIG_TABLE_SIZE = 4096;
+
+// sin(2*pi*i/N) for i in [0, N], built from a Taylor series using only
+// IEEE adds and multiplies, so the table is identical on every platform
+const float *GetSineTable() {
+  static float table[TRIG_TABLE_SIZE + 1];
+  static bool built = [] {
+    const double pi = 3.14159265358979323846;
+    const int quarter = TRIG_TABLE_SIZE / 4;
+    for (int i = 0; i <= quarter; i++) {
+      // Evaluate in the first quadrant, where the series converges fast
+      double x = (pi / 2.0) * ((double)i / quarter);
+      double x2 = x * x;
+      double term = x;
+      double sum = x;
+      for (int k = 1; k <= 12; k++) {
+        term *= -x2 / (double)((2 * k) * (2 * k + 1));
+        sum += term;
+      }
+      float value = (float)sum;
+      table[i] = value;                          // [0, pi/2]
+      table[2 * quarter - i] = value;            // [pi/2, pi]
+      table[2 * quarter + i] = 0.0f - value;     // [pi, 3pi/2] (no -0)
+      table[TRIG_TABLE_SIZE - i] = 0.0f - value; // [3pi/2, 2pi]
+    }
+    return true;
+  }();
+  (void)built;
+  return table;
+}
+
+float TableSine(float turns, const float *table) {
+  float index = turns * TRIG_TABLE_SIZE;
+  float base = floorf(index);
+  float frac = index - base;
+  int i = (int)base & (TRIG_TABLE_SIZE - 1);
+  return table[i] + (table[i + 1] - table[i]) * frac;
+}
+
+} // namespace
+
+void PortableSinCos(float degrees, float *sine, float *cosine) {
+  const float *table = GetSineTable();
+
+  // Wrap to [0, 1) turns; fmodf is exact so this is platform independent
+  float turns = fmodf(degrees, 360.0f) / 360.0f;
+  if (turns < 0.0f)
+    turns += 1.0f;
+
+  if (sine)
+    *sine = TableSine(turns, table);
+  if (cosine)
+    *cosine = TableSine(turns + 0.25f, table);
+}
+
 // Helper: Rotate point around origin
-Vector2 RotatePoint(Vector2 point, Vector2 origin, float angle) {
-  float s = sinf(angle * DEG2RAD);
-  float c = cosf(angle * DEG2RAD);
+Vector2 RotatePoint(Vector2 point, Vector2 origin, float angle,
+                    bool portable) {
+  float s, c;
+  SinCosDegrees(angle, portable, &s, &c);
 
   point = Vector2Subtract(point, origin);
 
@@ -347,7 +1045,8 @@ Vector2 RotatePoint(Vector2 point, Vector2 origin, float angle) {
 
 // Helper: Get rectangle vertices
 std::vector<Vector2> GetRectangleVertices(Vector2 pos, float width,
-                                          float height, float rotation) {
+                                          float height, float rotation,
+                                          bool portable) {
   float halfW = width / 2;
   float halfH = height / 2;
 
@@ -357,7 +1056,7 @@ std::vector<Vector2> GetRectangleVertices(Vector2 pos, float width,
   // Rotate and translate
   for (auto &v : verts) {
     if (rotation != 0.0f) {
-      v = RotatePoint(v, {0, 0}, rotation);
+      v = RotatePoint(v, {0, 0}, rotation, portable);
     }
     v = Vector2Add(v, pos);
   }
@@ -365,6 +1064,204 @@ std::vector<Vector2> GetRectangleVertices(Vector2 pos, float width,
   return verts;
 }
 
+// Helper: Outward edge normals (winding from the sign of the signed area)
+void ComputeEdgeNormals(const Vector2 *vertices, int count, Vector2 *normals) {
+  float area = 0.0f;
+  for (int i = 0; i < count; i++) {
+    Vector2 p1 = vertices[i];
+    Vector2 p2 = vertices[(i + 1) % count];
+    area += p1.x * p2.y - p2.x * p1.y;
+  }
+  float sign = area < 0.0f ? -1.0f : 1.0f;
+
+  for (int i = 0; i < count; i++) {
+    Vector2 edge = Vector2Subtract(vertices[(i + 1) % count], vertices[i]);
+    float length = Vector2Length(edge);
+    if (length > 0.0f) {
+      normals[i] = {sign * edge.y / length, -sign * edge.x / length};
+    } else {
+      normals[i] = {0.0f, 0.0f};
+    }
+  }
+}
+
+namespace {
+
+// Twice the signed area of triangle o-a-b (> 0 for positive winding)
+float Cross(Vector2 o, Vector2 a, Vector2 b) {
+  return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+float SignedArea(const std::vector<Vector2> &points) {
+  float area = 0.0f;
+  for (size_t i = 0; i < points.size(); i++) {
+    Vector2 p1 = points[i];
+    Vector2 p2 = points[(i + 1) % points.size()];
+    area += p1.x * p2.y - p2.x * p1.y;
+  }
+  return area * 0.5f;
+}
+
+// Convex within float noise: the sine of every turn stays above -1e-6
+bool IsConvexTurn(Vector2 prev, Vector2 cur, Vector2 next, float sign) {
+  Vector2 e1 = Vector2Subtract(cur, prev);
+  Vector2 e2 = Vector2Subtract(next, cur);
+  float tolerance = 1e-6f * Vector2Length(e1) * Vector2Length(e2);
+  return sign * Cross(prev, cur, next) >= -tolerance;
+}
+
+bool IsConvexLoop(const std::vector<Vector2> &points,
+                  const std::vector<int> &loop) {
+  size_t n = loop.size();
+  for (size_t i = 0; i < n; i++) {
+    if (!IsConvexTurn(points[loop[(i + n - 1) % n]], points[loop[i]],
+                      points[loop[(i + 1) % n]], 1.0f)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool PointInTriangle(Vector2 p, Vector2 a, Vector2 b, Vector2 c) {
+  return Cross(a, b, p) >= 0.0f && Cross(b, c, p) >= 0.0f &&
+         Cross(c, a, p) >= 0.0f;
+}
+
+} // namespace
+
+// Helper: Convexity test for either winding
+bool IsConvex(const std::vector<Vector2> &polygon) {
+  size_t n = polygon.size();
+  if (n < 4)
+    return true;
+
+  float sign = SignedArea(polygon) < 0.0f ? -1.0f : 1.0f;
+  for (size_t i = 0; i < n; i++) {
+    if (!IsConvexTurn(polygon[(i + n - 1) % n], polygon[i],
+                      polygon[(i + 1) % n], sign)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Helper: Convex decomposition. Ear clipping triangulates the polygon, then
+// Hertel-Mehlhorn drops every diagonal whose removal keeps the merged piece
+// convex (at most 4x the optimal piece count).
+std::vector<std::vector<Vector2>>
+DecomposeConvex(const std::vector<Vector2> &polygon) {
+  std::vector<std::vector<Vector2>> result;
+  int n = (int)polygon.size();
+  if (n < 3)
+    return result;
+  if (IsConvex(polygon)) {
+    result.push_back(polygon);
+    return result;
+  }
+
+  // Work on indices in positive winding
+  bool reversed = SignedArea(polygon) < 0.0f;
+  std::vector<int> remaining(n);
+  for (int i = 0; i < n; i++)
+    remaining[i] = reversed ? n - 1 - i : i;
+
+  // Ear clipping
+  std::vector<std::vector<int>> pieces;
+  while (remaining.size() > 3) {
+    int m = (int)remaining.size();
+    bool clipped = false;
+    for (int i = 0; i < m && !clipped; i++) {
+      int prev = remaining[(i + m - 1) % m];
+      int cur = remaining[i];
+      int next = remaining[(i + 1) % m];
+      if (Cross(polygon[prev], polygon[cur], polygon[next]) <= 0.0f)
+        continue; // Reflex or collinear
+
+      bool isEar = true;
+      for (int k : remaining) {
+        if (k == prev || k == cur || k == next)
+          continue;
+        if (PointInTriangle(polygon[k], polygon[prev], polygon[cur],
+                            polygon[next])) {
+          isEar = false;
+          break;
+        }
+      }
+      if (isEar) {
+        pieces.push_back({prev, cur, next});
+        remaining.erase(remaining.begin() + i);
+        clipped = true;
+      }
+    }
+
+    // Degenerate input (collinear runs, self-intersection): drop the
+    // flattest vertex so the loop always makes progress
+    if (!clipped) {
+      int flattest = 0;
+      float minTurn = std::numeric_limits<float>::max();
+      for (int i = 0; i < m; i++) {
+        float turn = fabsf(Cross(polygon[remaining[(i + m - 1) % m]],
+                                 polygon[remaining[i]],
+                                 polygon[remaining[(i + 1) % m]]));
+        if (turn < minTurn) {
+          minTurn = turn;
+          flattest = i;
+        }
+      }
+      remaining.erase(remaining.begin() + flattest);
+    }
+  }
+  if (Cross(polygon[remaining[0]], polygon[remaining[1]],
+            polygon[remaining[2]]) > 0.0f) {
+    pieces.push_back(remaining);
+  }
+
+  // Hertel-Mehlhorn: merge pieces across shared diagonals while convex
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (size_t i = 0; i < pieces.size() && !merged; i++) {
+      for (size_t j = i + 1; j < pieces.size() && !merged; j++) {
+        const std::vector<int> &pa = pieces[i];
+        const std::vector<int> &pb = pieces[j];
+        for (size_t k = 0; k < pa.size() && !merged; k++) {
+          int u = pa[k];
+          int v = pa[(k + 1) % pa.size()];
+          for (size_t m = 0; m < pb.size(); m++) {
+            if (pb[m] != v || pb[(m + 1) % pb.size()] != u)
+              continue;
+
+            // v..u around A, then B's vertices strictly between u and v
+            std::vector<int> loop;
+            for (size_t t = 0; t < pa.size(); t++)
+              loop.push_back(pa[(k + 1 + t) % pa.size()]);
+            for (size_t t = 2; t < pb.size(); t++)
+              loop.push_back(pb[(m + t) % pb.size()]);
+
+            if (IsConvexLoop(polygon, loop)) {
+              pieces[i] = loop;
+              pieces.erase(pieces.begin() + j);
+              merged = true;
+            }
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  // Back to the input's winding so rendering matches the original order
+  for (const auto &piece : pieces) {
+    std::vector<Vector2> points;
+    for (int index : piece)
+      points.push_back(polygon[index]);
+    if (reversed)
+      std::reverse(points.begin(), points.end());
+    result.push_back(points);
+  }
+  return result;
+}
+
 // Helper: Get bounding box of vertices
 Rectangle GetBoundingBox(const std::vector<Vector2> &vertices) {
   if (vertices.empty())
@@ -0,0 +1,375 @@
+#include "../../fumbo.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace Fumbo {
+namespace Graphic2D {
+
+namespace {
+thread_local CommandBuffer *recording = nullptr;
+
+// Payloads, one per command type (shapes sharing a layout share a struct)
+struct TexturePayload {
+  Texture2D texture;
+  Vector2 position;
+  Vector2 size;
+  float rotation;
+  Color tint;
+};
+
+struct TextureProPayload {
+  Texture2D texture;
+  Rectangle source;
+  Rectangle dest;
+  Vector2 origin;
+  float rotation;
+  Color tint;
+};
+
+struct TextPayload {
+  Font font;
+  Vector2 position;
+  int fontSize;
+  Color color; // NUL-terminated text follows the payload
+};
+
+struct RectanglePayload {
+  Rectangle rectangle; // Integer calls store whole values
+  Vector2 origin;
+  float value; // Rotation or line thickness
+  Color color;
+};
+
+struct CirclePayload {
+  Vector2 center;
+  float radius;
+  Color color;
+};
+
+struct LinePayload {
+  Vector2 start;
+  Vector2 end;
+  float thickness;
+  Color color;
+};
+
+struct TrianglePayload {
+  Vector2 vertices[3];
+  Color color;
+};
+
+// Replay goes through the wrappers, which must draw rather than record
+struct RecordingPause {
+  CommandBuffer *saved = recording;
+  RecordingPause() { recording = nullptr; }
+  ~RecordingPause() { recording = saved; }
+};
+} // namespace
+
+// Recording
+
+void CommandBuffer::BeginRecording() { recording = this; }
+
+void CommandBuffer::EndRecording() {
+  if (recording == this) {
+    recording = nullptr;
+  }
+}
+
+CommandBuffer *CommandBuffer::GetRecording() { return recording; }
+
+void CommandBuffer::Clear() {
+  commands.clear();
+  arena.clear();
+  shaders.clear();
+  currentLayer = 0;
+  currentShader = 0;
+}
+
+void CommandBuffer::SetShader(Shader shader) {
+  if (shaders.empty()) {
+    shaders.push_back(Shader{}); // Slot 0: default shader
+  }
+  for (size_t i = 1; i < shaders.size(); i++) {
+    if (shaders[i].id == shader.id) {
+      currentShader = (uint16_t)i;
+      return;
+    }
+  }
+  shaders.push_back(shader);
+  currentShader = (uint16_t)(shaders.size() - 1);
+}
+
+template <typename Payload>
+void CommandBuffer::Record(CommandType type, uint32_t textureId,
+                           const Payload &payload, const void *extra,
+                           size_t extraSize) {
+  // Payloads start 4-byte aligned; Read() copies them out regardless
+  size_t offset = (arena.size() + 3) & ~(size_t)3;
+  arena.resize(offset + sizeof(Payload) + extraSize);
+  std::memcpy(arena.data() + offset, &payload, sizeof(Payload));
+  if (extraSize > 0) {
+    std::memcpy(arena.data() + offset + sizeof(Payload), extra, extraSize);
+  }
+  commands.push_back(
+      {type, currentShader, currentLayer, textureId, (uint32_t)offset});
+}
+
+template <typename Payload>
+Payload CommandBuffer::Read(uint32_t offset) const {
+  Payload payload;
+  std::memcpy(&payload, arena.data() + offset, sizeof(Payload));
+  return payload;
+}
+
+void CommandBuffer::DrawTexture(Texture2D texture, Vector2 basePos,
+                                Vector2 baseSize, float rotation, Color tint) {
+  Record(CommandType::Texture, texture.id,
+         TexturePayload{texture, basePos, baseSize, rotation, tint});
+}
+
+void CommandBuffer::DrawTexturePro(Texture2D texture, Rectangle source,
+                                   Rectangle dest, Vector2 origin,
+                                   float rotation, Color tint) {
+  Record(CommandType::TexturePro, texture.id,
+         TextureProPayload{texture, source, dest, origin, rotation, tint});
+}
+
+void CommandBuffer::DrawBackground(Texture2D backgroundTex) {
+  Record(CommandType::Background, backgroundTex.id,
+         TexturePayload{backgroundTex, {0, 0}, {0, 0}, 0.0f, WHITE});
+}
+
+void CommandBuffer::DrawText(const char *text, Vector2 basePos, Font font,
+                             int baseFontSize, Color color) {
+  // Stored with its terminator so replay can pass it straight through
+  size_t length = std::strlen(text);
+  Record(CommandType::Text, font.texture.id,
+         TextPayload{font, basePos, baseFontSize, color}, text, length + 1);
+}
+
+void CommandBuffer::DrawRectangle(int posX, int posY, int width, int height,
+                                  Color color) {
+  Record(CommandType::Rectangle, 0,
+         RectanglePayload{{(float)posX, (float)posY, (float)width,
+                           (float)height},
+                          {0, 0},
+                          0.0f,
+                          color});
+}
+
+void CommandBuffer::DrawRectangleV(Vector2 position, Vector2 size,
+                                   Color color) {
+  Record(CommandType::RectangleV, 0,
+         RectanglePayload{
+             {position.x, position.y, size.x, size.y}, {0, 0}, 0.0f, color});
+}
+
+void CommandBuffer::DrawRectangleRec(Rectangle rectangle, Color color) {
+  Record(CommandType::RectangleRec, 0,
+         RectanglePayload{rectangle, {0, 0}, 0.0f, color});
+}
+
+void CommandBuffer::DrawRectanglePro(Rectangle rectangle, Vector2 origin,
+                                     float rotation, Color color) {
+  Record(CommandType::RectanglePro, 0,
+         RectanglePayload{rectangle, origin, rotation, color});
+}
+
+void CommandBuffer::DrawRectangleLinesEx(Rectangle rectangle, float lineThick,
+                                         Color color) {
+  Record(CommandType::RectangleLinesEx, 0,
+         RectanglePayload{rectangle, {0, 0}, lineThick, color});
+}
+
+void CommandBuffer::DrawCircle(int centerX, int centerY, float radius,
+                               Color color) {
+  Record(CommandType::Circle, 0,
+         CirclePayload{{(float)centerX, (float)centerY}, radius, color});
+}
+
+void CommandBuffer::DrawCircleV(Vector2 center, float radius, Color color) {
+  Record(CommandType::CircleV, 0, CirclePayload{center, radius, color});
+}
+
+void CommandBuffer::DrawCircleLinesV(Vector2 center, float radius,
+                                     Color color) {
+  Record(CommandType::CircleLinesV, 0, CirclePayload{center, radius, color});
+}
+
+void CommandBuffer::DrawLineV(Vector2 startPos, Vector2 endPos, Color color) {
+  Record(CommandType::LineV, 0, LinePayload{startPos, endPos, 1.0f, color});
+}
+
+void CommandBuffer::DrawLineEx(Vector2 startPos, Vector2 endPos,
+                               float thickness, Color color) {
+  Record(CommandType::LineEx, 0,
+         LinePayload{startPos, endPos, thickness, color});
+}
+
+void CommandBuffer::DrawTriangle(Vector2 vertex1, Vector2 vertex2,
+                                 Vector2 vertex3, Color color) {
+  Record(CommandType::Triangle, 0,
+         TrianglePayload{{vertex1, vertex2, vertex3}, color});
+}
+
+// Merging and ordering
+
+void CommandBuffer::Append(const CommandBuffer &other) {
+  if (&other == this || other.commands.empty())
+    return;
+
+  // Other's shader slots, remapped into ours
+  std::vector<uint16_t> shaderSlots(other.shaders.size(), 0);
+  uint16_t savedShader = currentShader;
+  for (size_t i = 1; i < other.shaders.size(); i++) {
+    SetShader(other.shaders[i]);
+    shaderSlots[i] = currentShader;
+  }
+  currentShader = savedShader;
+
+  size_t base = (arena.size() + 3) & ~(size_t)3;
+  arena.resize(base);
+  arena.insert(arena.end(), other.arena.begin(), other.arena.end());
+
+  commands.reserve(commands.size() + other.commands.size());
+  for (Command command : other.commands) {
+    command.shader = shaderSlots.empty() ? 0 : shaderSlots[command.shader];
+    command.offset += (uint32_t)base;
+    commands.push_back(command);
+  }
+}
+
+void CommandBuffer::Sort(bool groupByState) {
+  // Same layer key as SpriteBatch: the sign flip orders signed layers
+  auto key = [groupByState](const Command &command) {
+    uint64_t layerBits = (uint32_t)command.layer ^ 0x80000000u;
+    uint64_t result = layerBits << 32;
+    if (groupByState) {
+      result |= (uint64_t)command.shader << 16 | (command.textureId & 0xFFFF);
+    }
+    return result;
+  };
+  std::stable_sort(commands.begin(), commands.end(),
+                   [&key](const Command &a, const Command &b) {
+                     return key(a) < key(b);
+                   });
+}
+
+// Replay
+
+void CommandBuffer::Replay() const {
+  RecordingPause pause;
+
+  uint16_t activeShader = 0;
+  for (const Command &command : commands) {
+    if (command.shader != activeShader) {
+      if (activeShader != 0) {
+        EndShaderMode();
+      }
+      if (command.shader != 0) {
+        BeginShaderMode(shaders[command.shader]);
+      }
+      activeShader = command.shader;
+    }
+    ReplayCommand(command);
+  }
+  if (activeShader != 0) {
+    EndShaderMode();
+  }
+}
+
+void CommandBuffer::ReplayCommand(const Command &command) const {
+  switch (command.type) {
+  case CommandType::Texture: {
+    auto p = Read<TexturePayload>(command.offset);
+    Fumbo::Graphic2D::DrawTexture(p.texture, p.position, p.size, p.rotation,
+                                  p.tint);
+    break;
+  }
+  case CommandType::TexturePro: {
+    auto p = Read<TextureProPayload>(command.offset);
+    Fumbo::Graphic2D::DrawTexturePro(p.texture, p.source, p.dest, p.origin,
+                                     p.rotation, p.tint);
+    break;
+  }
+  case CommandType::Background: {
+    auto p = Read<TexturePayload>(command.offset);
+    Fumbo::Graphic2D::DrawBackground(p.texture);
+    break;
+  }
+  case CommandType::Text: {
+    auto p = Read<TextPayload>(command.offset);
+    const char *text =
+        (const char *)arena.data() + command.offset + sizeof(TextPayload);
+    Fumbo::Graphic2D::DrawText(text, p.position, p.font, p.fontSize,
+                               p.color);
+    break;
+  }
+  case CommandType::Rectangle: {
+    auto p = Read<RectanglePayload>(command.offset);
+    Fumbo::Graphic2D::DrawRectangle(
+        (int)p.rectangle.x, (int)p.rectangle.y, (int)p.rectangle.width,
+        (int)p.rectangle.height, p.color);
+    break;
+  }
+  case CommandType::RectangleV: {
+    auto p = Read<RectanglePayload>(command.offset);
+    Fumbo::Graphic2D::DrawRectangleV({p.rectangle.x, p.rectangle.y},
+                                     {p.rectangle.width, p.rectangle.height},
+                                     p.color);
+    break;
+  }
+  case CommandType::RectangleRec: {
+    auto p = Read<RectanglePayload>(command.offset);
+    Fumbo::Graphic2D::DrawRectangleRec(p.rectangle, p.color);
+    break;
+  }
+  case CommandType::RectanglePro: {
+    auto p = Read<RectanglePayload>(command.offset);
+    Fumbo::Graphic2D::DrawRectanglePro(p.rectangle, p.origin, p.value,
+                                       p.color);
+    break;
+  }
+  case CommandType::RectangleLinesEx: {
+    auto p = Read<RectanglePayload>(command.offset);
+    Fumbo::Graphic2D::DrawRectangleLinesEx(p.rectangle, p.value, p.color);
+    break;
+  }
+  case CommandType::Circle: {
+    auto p = Read<CirclePayload>(command.offset);
+    Fumbo::Graphic2D::DrawCircle((int)p.center.x, (int)p.center.y, p.radius,
+                                 p.color);
+    break;
+  }
+  case CommandType::CircleV: {
+    auto p = Read<CirclePayload>(command.offset);
+    Fumbo::Graphic2D::DrawCircleV(p.center, p.radius, p.color);
+    break;
+  }
+  case CommandType::CircleLinesV: {
+    auto p = Read<CirclePayload>(command.offset);
+    Fumbo::Graphic2D::DrawCircleLinesV(p.center, p.radius, p.color);
+    break;
+  }
+  case CommandType::LineV: {
+    auto p = Read<LinePayload>(command.offset);
+    Fumbo::Graphic2D::DrawLineV(p.start, p.end, p.color);
+    break;
+  }
+  case CommandType::LineEx: {
+    auto p = Read<LinePayload>(command.offset);
+    Fumbo::Graphic2D::DrawLineEx(p.start, p.end, p.thickness, p.color);
+    break;
+  }
+  case CommandType::Triangle: {
+    auto p = Read<TrianglePayload>(command.offset);
+    Fumbo::Graphic2D::DrawTriangle(p.vertices[0], p.vertices[1],
+                                   p.vertices[2], p.color);
+    break;
+  }
+  }
+}
+
+} // namespace Graphic2D
+} // namespace Fumbo
@@ -6,8 +6,8 @@
 // Helper to scale a point array
 static void ScalePoints(const Vector2 *points, int pointCount,
                         Vector2 *outPoints, Vector2 scale) {
+  Vector2 offset = Fumbo::Utils::GetUITransform().offset;
   for (int i = 0; i < pointCount; i++) {
-    Vector2 offset = Fumbo::Utils::GetUIOffset();
     outPoints[i].x = points[i].x * scale.x + offset.x;
     outPoints[i].y = points[i].y * scale.y + offset.y;
   }
@@ -15,8 +15,7 @@ static void ScalePoints(const Vector2 *points, int pointCount,
 
 namespace Fumbo {
 namespace Graphic2D {
-using Fumbo::Utils::GetUIOffset;
-using Fumbo::Utils::GetUIScale;
+using Fumbo::Utils::GetUITransform;
 
 Texture2D CaptureScreenToTexture() {
   Image screenImage = LoadImageFromScreen();
@@ -27,22 +26,35 @@ Texture2D CaptureScreenToTexture() {
 
 void DrawText(const std::string &text, Vector2 basePos, Font font,
               int baseFontSize, Color color) {
-  Vector2 scale = GetUIScale();
+  DrawText(text.c_str(), basePos, font, baseFontSize, color);
+}
+
+void DrawText(const char *text, Vector2 basePos, Font font, int baseFontSize,
+              Color color) {
+  if (CommandBuffer *buffer = CommandBuffer::GetRecording()) {
+    buffer->DrawText(text, basePos, font, baseFontSize, color);
+    return;
+  }
+  Vector2 scale = GetUITransform().scale;
   float fontSize = baseFontSize * scale.y;
-  Vector2 offset = GetUIOffset();
+  Vector2 offset = GetUITransform().offset;
   Vector2 position = {basePos.x * scale.x + offset.x,
                       basePos.y * scale.y + offset.y};
 
-  ::DrawTextEx(font, text.c_str(), position, fontSize, 1.0f * scale.x, color);
+  ::DrawTextEx(font, text, position, fontSize, 1.0f * scale.x, color);
 }
 
 void DrawTexture(Texture2D texture, Vector2 basePos, Vector2 baseSize,
                  float rotation, Color tint) {
-  Vector2 scale = GetUIScale();
+  if (CommandBuffer *buffer = CommandBuffer::GetRecording()) {
+    buffer->DrawTexture(texture, basePos, baseSize, rotation, tint);
+    return;
+  }
+  Vector2 scale = GetUITransform().scale;
 
   Rectangle sourceRect = {0, 0, (float)texture.width, (float)texture.height};
 
-  Vector2 offset = GetUIOffset();
+  Vector2 offset = GetUITransform().offset;
   Rectangle destRect = {basePos.x * scale.x + offset.x,
                         basePos.y * scale.y + offset.y, baseSize.x * scale.x,
                         baseSize.y * scale.y};
@@ -54,8 +66,12 @@ void DrawTexture(Texture2D texture, Vector2 basePos, Vector2 baseSize,
 
 void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest,
                     Vector2 origin, float rotation, Color tint) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  if (CommandBuffer *buffer = CommandBuffer::GetRecording()) {
+    buffer->DrawTexturePro(texture, source, dest, origin, rotation, tint);
+    return;
+  }
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   Rectangle destRect = {dest.x * scale.x + offset.x,
                         dest.y * scale.y + offset.y, dest.width * scale.x,
                         dest.height * scale.y};
@@ -66,15 +82,15 @@ void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest,
 // Dynamic Shapes
 
 void DrawPixel(int posX, int posY, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawPixel((int)(posX * scale.x + offset.x),
               (int)(posY * scale.y + offset.y), color);
 }
 
 void DrawPixelV(Vector2 position, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawPixelV(
       {position.x * scale.x + offset.x, position.y * scale.y + offset.y},
       color);
@@ -82,8 +98,8 @@ void DrawPixelV(Vector2 position, Color color) {
 
 void DrawLine(int startPosX, int startPosY, int endPosX, int endPosY,
               Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawLine((int)(startPosX * scale.x + offset.x),
              (int)(startPosY * scale.y + offset.y),
              (int)(endPosX * scale.x + offset.x),
@@ -91,8 +107,12 @@ void DrawLine(int startPosX, int startPosY, int endPosX, int endPosY,
 }
 
 void DrawLineV(Vector2 startPos, Vector2 endPos, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  if (CommandBuffer *buffer = CommandBuffer::GetRecording()) {
+    buffer->DrawLineV(startPos, endPos, color);
+    return;
+  }
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawLineV(
       {startPos.x * scale.x + offset.x, startPos.y * scale.y + offset.y},
       {endPos.x * scale.x + offset.x, endPos.y * scale.y + offset.y}, color);
@@ -100,8 +120,12 @@ void DrawLineV(Vector2 startPos, Vector2 endPos, Color color) {
 
 void DrawLineEx(Vector2 startPos, Vector2 endPos, float thickness,
                 Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  if (CommandBuffer *buffer = CommandBuffer::GetRecording()) {
+    buffer->DrawLineEx(startPos, endPos, thickness, color);
+    return;
+  }
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawLineEx(
       {startPos.x * scale.x + offset.x, startPos.y * scale.y + offset.y},
       {endPos.x * scale.x + offset.x, endPos.y * scale.y + offset.y},
@@ -109,17 +133,18 @@ void DrawLineEx(Vector2 startPos, Vector2 endPos, float thickness,
 }
 
 void DrawLineStrip(const Vector2 *points, int pointCount, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 *scaledPoints = new Vector2[pointCount];
+  Vector2 scale = GetUITransform().scale;
+  Utils::FrameAllocator::Scope scratch;
+  Vector2 *scaledPoints =
+      Utils::FrameAllocator::Instance().AllocateArray<Vector2>(pointCount);
   ScalePoints(points, pointCount, scaledPoints, scale);
   ::DrawLineStrip(scaledPoints, pointCount, color);
-  delete[] scaledPoints;
 }
 
 void DrawLineBezier(Vector2 startPos, Vector2 endPos, float thickness,
                     Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawLineBezier(
       {startPos.x * scale.x + offset.x, startPos.y * scale.y + offset.y},
       {endPos.x * scale.x + offset.x, endPos.y * scale.y + offset.y},
@@ -127,16 +152,20 @@ void DrawLineBezier(Vector2 startPos, Vector2 endPos, float thickness,
 }
 
 void DrawCircle(int centerX, int centerY, float radius, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  if (CommandBuffer *buffer = CommandBuffer::GetRecording()) {
+    buffer->DrawCircle(centerX, centerY, radius, color);
+    return;
+  }
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawCircle((int)(centerX * scale.x + offset.x),
                (int)(centerY * scale.y + offset.y), radius * scale.y, color);
 }
 
 void DrawCircleSector(Vector2 center, float radius, float startAngle,
                       float endAngle, int segments, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawCircleSector(
       {center.x * scale.x + offset.x, center.y * scale.y + offset.y},
       radius * scale.y, startAngle, endAngle, segments, color);
@@ -144,8 +173,8 @@ void DrawCircleSector(Vector2 center, float radius, float startAngle,
 
 void DrawCircleSectorLines(Vector2 center, float radius, float startAngle,
                            float endAngle, int segments, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawCircleSectorLines(
       {center.x * scale.x + offset.x, center.y * scale.y + offset.y},
       radius * scale.y, startAngle, endAngle, segments, color);
@@ -153,31 +182,39 @@ void DrawCircleSectorLines(Vector2 center, float radius, float startAngle,
 
 void DrawCircleGradient(int centerX, int centerY, float radius, Color inner,
                         Color outer) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawCircleGradient((int)(centerX * scale.x + offset.x),
                        (int)(centerY * scale.y + offset.y), radius * scale.y,
                        inner, outer);
 }
 
 void DrawCircleV(Vector2 center, float radius, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  if (CommandBuffer *buffer = CommandBuffer::GetRecording()) {
+    buffer->DrawCircleV(center, radius, color);
+    return;
+  }
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawCircleV({center.x * scale.x + offset.x, center.y * scale.y + offset.y},
                 radius * scale.y, color);
 }
 
 void DrawCircleLines(int centerX, int centerY, float radius, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawCircleLines((int)(centerX * scale.x + offset.x),
                     (int)(centerY * scale.y + offset.y), radius * scale.y,
                     color);
 }
 
 void DrawCircleLinesV(Vector2 center, float radius, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  if (CommandBuffer *buffer = CommandBuffer::GetRecording()) {
+    buffer->DrawCircleLinesV(center, radius, color);
+    return;
+  }
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawCircleLinesV(
       {center.x * scale.x + offset.x, center.y * scale.y + offset.y},
       radius * scale.y, color);
@@ -185,8 +222,8 @@ void DrawCircleLinesV(Vector2 center, float radius, Color color) {
 
 void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV,
                  Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawEllipse((int)(centerX * scale.x + offset.x),
                 (int)(centerY * scale.y + offset.y), radiusH * scale.x,
                 radiusV * scale.y, color);
@@ -194,8 +231,8 @@ void DrawEllipse(int centerX, int centerY, float radiusH, float radiusV,
 
 void DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV,
                       Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawEllipseLines((int)(centerX * scale.x + offset.x),
                      (int)(centerY * scale.y + offset.y), radiusH * scale.x,
                      radiusV * scale.y, color);
@@ -203,8 +240,8 @@ void DrawEllipseLines(int centerX, int centerY, float radiusH, float radiusV,
 
 void DrawRing(Vector2 center, float innerRadius, float outerRadius,
               float startAngle, float endAngle, int segments, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawRing({center.x * scale.x + offset.x, center.y * scale.y + offset.y},
              innerRadius * scale.y, outerRadius * scale.y, startAngle, endAngle,
              segments, color);
@@ -213,8 +250,8 @@ void DrawRing(Vector2 center, float innerRadius, float outerRadius,
 void DrawRingLines(Vector2 center, float innerRadius, float outerRadius,
                    float startAngle, float endAngle, int segments,
                    Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawRingLines(
       {center.x * scale.x + offset.x, center.y * scale.y + offset.y},
       innerRadius * scale.y, outerRadius * scale.y, startAngle, endAngle,
@@ -222,24 +259,36 @@ void DrawRingLines(Vector2 center, float innerRadius, float outerRadius,
 }
 
 void DrawRectangle(int posX, int posY, int width, int height, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  if (CommandBuffer *buffer = CommandBuffer::GetRecording()) {
+    buffer->DrawRectangle(posX, posY, width, height, color);
+    return;
+  }
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawRectangle((int)(posX * scale.x + offset.x),
                   (int)(posY * scale.y + offset.y), (int)(width * scale.x),
                   (int)(height * scale.y), color);
 }
 
 void DrawRectangleV(Vector2 position, Vector2 size, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  if (CommandBuffer *buffer = CommandBuffer::GetRecording()) {
+    buffer->DrawRectangleV(position, size, color);
+    return;
+  }
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawRectangleV(
       {position.x * scale.x + offset.x, position.y * scale.y + offset.y},
       {size.x * scale.x, size.y * scale.y}, color);
 }
 
 void DrawRectangleRec(Rectangle rectangle, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  if (CommandBuffer *buffer = CommandBuffer::GetRecording()) {
+    buffer->DrawRectangleRec(rectangle, color);
+    return;
+  }
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawRectangleRec({rectangle.x * scale.x + offset.x,
                       rectangle.y * scale.y + offset.y,
                       rectangle.width * scale.x, rectangle.height * scale.y},
@@ -248,8 +297,12 @@ void DrawRectangleRec(Rectangle rectangle, Color color) {
 
 void DrawRectanglePro(Rectangle rectangle, Vector2 origin, float rotation,
                       Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  if (CommandBuffer *buffer = CommandBuffer::GetRecording()) {
+    buffer->DrawRectanglePro(rectangle, origin, rotation, color);
+    return;
+  }
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawRectanglePro({rectangle.x * scale.x + offset.x,
                       rectangle.y * scale.y + offset.y,
                       rectangle.width * scale.x, rectangle.height * scale.y},
@@ -258,8 +311,8 @@ void DrawRectanglePro(Rectangle rectangle, Vector2 origin, float rotation,
 
 void DrawRectangleGradientV(int posX, int posY, int width, int height,
                             Color top, Color bottom) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawRectangleGradientV(
       (int)(posX * scale.x + offset.x), (int)(posY * scale.y + offset.y),
       (int)(width * scale.x), (int)(height * scale.y), top, bottom);
@@ -267,8 +320,8 @@ void DrawRectangleGradientV(int posX, int posY, int width, int height,
 
 void DrawRectangleGradientH(int posX, int posY, int width, int height,
                             Color left, Color right) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawRectangleGradientH(
       (int)(posX * scale.x + offset.x), (int)(posY * scale.y + offset.y),
       (int)(width * scale.x), (int)(height * scale.y), left, right);
@@ -277,8 +330,8 @@ void DrawRectangleGradientH(int posX, int posY, int width, int height,
 void DrawRectangleGradientEx(Rectangle rectangle, Color topLeft,
                              Color bottomLeft, Color topRight,
                              Color bottomRight) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawRectangleGradientEx(
       {rectangle.x * scale.x + offset.x, rectangle.y * scale.y + offset.y,
        rectangle.width * scale.x, rectangle.height * scale.y},
@@ -287,16 +340,20 @@ void DrawRectangleGradientEx(Rectangle rectangle, Color topLeft,
 
 void DrawRectangleLines(int posX, int posY, int width, int height,
                         Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawRectangleLines((int)(posX * scale.x + offset.x),
                        (int)(posY * scale.y + offset.y), (int)(width * scale.x),
                        (int)(height * scale.y), color);
 }
 
 void DrawRectangleLinesEx(Rectangle rectangle, float lineThick, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  if (CommandBuffer *buffer = CommandBuffer::GetRecording()) {
+    buffer->DrawRectangleLinesEx(rectangle, lineThick, color);
+    return;
+  }
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawRectangleLinesEx(
       {rectangle.x * scale.x + offset.x, rectangle.y * scale.y + offset.y,
        rectangle.width * scale.x, rectangle.height * scale.y},
@@ -305,8 +362,8 @@ void DrawRectangleLinesEx(Rectangle rectangle, float lineThick, Color color) {
 
 void DrawRectangleRounded(Rectangle rectangle, float roundness, int segments,
                           Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawRectangleRounded(
       {rectangle.x * scale.x + offset.x, rectangle.y * scale.y + offset.y,
        rectangle.width * scale.x, rectangle.height * scale.y},
@@ -315,8 +372,8 @@ void DrawRectangleRounded(Rectangle rectangle, float roundness, int segments,
 
 void DrawRectangleRoundedLines(Rectangle rectangle, float roundness,
                                int segments, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawRectangleRoundedLines(
       {rectangle.x * scale.x + offset.x, rectangle.y * scale.y + offset.y,
        rectangle.width * scale.x, rectangle.height * scale.y},
@@ -325,8 +382,8 @@ void DrawRectangleRoundedLines(Rectangle rectangle, float roundness,
 
 void DrawRectangleRoundedLinesEx(Rectangle rectangle, float roundness,
                                  int segments, float lineThick, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawRectangleRoundedLinesEx(
       {rectangle.x * scale.x + offset.x, rectangle.y * scale.y + offset.y,
        rectangle.width * scale.x, rectangle.height * scale.y},
@@ -335,8 +392,12 @@ void DrawRectangleRoundedLinesEx(Rectangle rectangle, float roundness,
 
 void DrawTriangle(Vector2 vertex1, Vector2 vertex2, Vector2 vertex3,
                   Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  if (CommandBuffer *buffer = CommandBuffer::GetRecording()) {
+    buffer->DrawTriangle(vertex1, vertex2, vertex3, color);
+    return;
+  }
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawTriangle(
       {vertex1.x * scale.x + offset.x, vertex1.y * scale.y + offset.y},
       {vertex2.x * scale.x + offset.x, vertex2.y * scale.y + offset.y},
@@ -345,8 +406,8 @@ void DrawTriangle(Vector2 vertex1, Vector2 vertex2, Vector2 vertex3,
 
 void DrawTriangleLines(Vector2 vertex1, Vector2 vertex2, Vector2 vertex3,
                        Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawTriangleLines(
       {vertex1.x * scale.x + offset.x, vertex1.y * scale.y + offset.y},
       {vertex2.x * scale.x + offset.x, vertex2.y * scale.y + offset.y},
@@ -354,33 +415,35 @@ void DrawTriangleLines(Vector2 vertex1, Vector2 vertex2, Vector2 vertex3,
 }
 
 void DrawTriangleFan(const Vector2 *points, int pointCount, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 *scaledPoints = new Vector2[pointCount];
+  Vector2 scale = GetUITransform().scale;
+  Utils::FrameAllocator::Scope scratch;
+  Vector2 *scaledPoints =
+      Utils::FrameAllocator::Instance().AllocateArray<Vector2>(pointCount);
   ScalePoints(points, pointCount, scaledPoints, scale);
   ::DrawTriangleFan(scaledPoints, pointCount, color);
-  delete[] scaledPoints;
 }
 
 void DrawTriangleStrip(const Vector2 *points, int pointCount, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 *scaledPoints = new Vector2[pointCount];
+  Vector2 scale = GetUITransform().scale;
+  Utils::FrameAllocator::Scope scratch;
+  Vector2 *scaledPoints =
+      Utils::FrameAllocator::Instance().AllocateArray<Vector2>(pointCount);
   ScalePoints(points, pointCount, scaledPoints, scale);
   ::DrawTriangleStrip(scaledPoints, pointCount, color);
-  delete[] scaledPoints;
 }
 
 void DrawPoly(Vector2 center, int sides, float radius, float rotation,
               Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawPoly({center.x * scale.x + offset.x, center.y * scale.y + offset.y},
              sides, radius * scale.y, rotation, color);
 }
 
 void DrawPolyLines(Vector2 center, int sides, float radius, float rotation,
                    Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawPolyLines(
       {center.x * scale.x + offset.x, center.y * scale.y + offset.y}, sides,
       radius * scale.y, rotation, color);
@@ -388,8 +451,8 @@ void DrawPolyLines(Vector2 center, int sides, float radius, float rotation,
 
 void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation,
                      float lineThick, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawPolyLinesEx(
       {center.x * scale.x + offset.x, center.y * scale.y + offset.y}, sides,
       radius * scale.y, rotation, lineThick * scale.y, color);
@@ -397,54 +460,59 @@ void DrawPolyLinesEx(Vector2 center, int sides, float radius, float rotation,
 
 void DrawSplineLinear(const Vector2 *points, int pointCount, float thickness,
                       Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 *scaledPoints = new Vector2[pointCount];
+  Vector2 scale = GetUITransform().scale;
+  Utils::FrameAllocator::Scope scratch;
+  Vector2 *scaledPoints =
+      Utils::FrameAllocator::Instance().AllocateArray<Vector2>(pointCount);
   ScalePoints(points, pointCount, scaledPoints, scale);
   ::DrawSplineLinear(scaledPoints, pointCount, thickness * scale.y, color);
-  delete[] scaledPoints;
 }
 
 void DrawSplineBasis(const Vector2 *points, int pointCount, float thickness,
                      Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 *scaledPoints = new Vector2[pointCount];
+  Vector2 scale = GetUITransform().scale;
+  Utils::FrameAllocator::Scope scratch;
+  Vector2 *scaledPoints =
+      Utils::FrameAllocator::Instance().AllocateArray<Vector2>(pointCount);
   ScalePoints(points, pointCount, scaledPoints, scale);
   ::DrawSplineBasis(scaledPoints, pointCount, thickness * scale.y, color);
-  delete[] scaledPoints;
 }
 
 void DrawSplineCatmullRom(const Vector2 *points, int pointCount,
                           float thickness, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 *scaledPoints = new Vector2[pointCount];
+  Vector2 scale = GetUITransform().scale;
+  Utils::FrameAllocator::Scope scratch;
+  Vector2 *scaledPoints =
+      Utils::FrameAllocator::Instance().AllocateArray<Vector2>(pointCount);
   ScalePoints(points, pointCount, scaledPoints, scale);
   ::DrawSplineCatmullRom(scaledPoints, pointCount, thickness * scale.y, color);
-  delete[] scaledPoints;
 }
 
 void DrawSplineBezierQuadratic(const Vector2 *points, int pointCount,
                                float thickness, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 *scaledPoints = new Vector2[pointCount];
+  Vector2 scale = GetUITransform().scale;
+  Utils::FrameAllocator::Scope scratch;
+  Vector2 *scaledPoints =
+      Utils::FrameAllocator::Instance().AllocateArray<Vector2>(pointCount);
   ScalePoints(points, pointCount, scaledPoints, scale);
   ::DrawSplineBezierQuadratic(scaledPoints, pointCount, thickness * scale.y,
                               color);
-  delete[] scaledPoints;
 }
 
 void DrawSplineBezierCubic(const Vector2 *points, int pointCount,
                            float thickness, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 *scaledPoints = new Vector2[pointCount];
+  Vector2 scale = GetUITransform().scale;
+  Utils::FrameAllocator::Scope scratch;
+  Vector2 *scaledPoints =
+      Utils::FrameAllocator::Instance().AllocateArray<Vector2>(pointCount);
   ScalePoints(points, pointCount, scaledPoints, scale);
   ::DrawSplineBezierCubic(scaledPoints, pointCount, thickness * scale.y, color);
-  delete[] scaledPoints;
 }
 
 void DrawSplineSegmentLinear(Vector2 point1, Vector2 point2, float thickness,
                              Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawSplineSegmentLinear(
       {point1.x * scale.x + offset.x, point1.y * scale.y + offset.y},
       {point2.x * scale.x + offset.x, point2.y * scale.y + offset.y},
@@ -453,8 +521,8 @@ void DrawSplineSegmentLinear(Vector2 point1, Vector2 point2, float thickness,
 
 void DrawSplineSegmentBasis(Vector2 point1, Vector2 point2, Vector2 point3,
                             Vector2 point4, float thickness, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawSplineSegmentBasis(
       {point1.x * scale.x + offset.x, point1.y * scale.y + offset.y},
       {point2.x * scale.x + offset.x, point2.y * scale.y + offset.y},
@@ -465,8 +533,8 @@ void DrawSplineSegmentBasis(Vector2 point1, Vector2 point2, Vector2 point3,
 
 void DrawSplineSegmentCatmullRom(Vector2 point1, Vector2 point2, Vector2 point3,
                                  Vector2 point4, float thickness, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawSplineSegmentCatmullRom(
       {point1.x * scale.x + offset.x, point1.y * scale.y + offset.y},
       {point2.x * scale.x + offset.x, point2.y * scale.y + offset.y},
@@ -478,8 +546,8 @@ void DrawSplineSegmentCatmullRom(Vector2 point1, Vector2 point2, Vector2 point3,
 void DrawSplineSegmentBezierQuadratic(Vector2 point1, Vector2 control2,
                                       Vector2 point3, float thickness,
                                       Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawSplineSegmentBezierQuadratic(
       {point1.x * scale.x + offset.x, point1.y * scale.y + offset.y},
       {control2.x * scale.x + offset.x, control2.y * scale.y + offset.y},
@@ -490,8 +558,8 @@ void DrawSplineSegmentBezierQuadratic(Vector2 point1, Vector2 control2,
 void DrawSplineSegmentBezierCubic(Vector2 point1, Vector2 control2,
                                   Vector2 control3, Vector2 point4,
                                   float thickness, Color color) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawSplineSegmentBezierCubic(
       {point1.x * scale.x + offset.x, point1.y * scale.y + offset.y},
       {control2.x * scale.x + offset.x, control2.y * scale.y + offset.y},
@@ -501,6 +569,10 @@ void DrawSplineSegmentBezierCubic(Vector2 point1, Vector2 control2,
 }
 
 void DrawBackground(Texture2D backgroundTex) {
+  if (CommandBuffer *buffer = CommandBuffer::GetRecording()) {
+    buffer->DrawBackground(backgroundTex);
+    return;
+  }
   ::DrawTexturePro(
       backgroundTex,
       Rectangle{0, 0, (float)backgroundTex.width, (float)backgroundTex.height},
@@ -510,8 +582,8 @@ void DrawBackground(Texture2D backgroundTex) {
 
 void DrawTextureRec(Texture2D texture, Rectangle source, Vector2 position,
                     Color tint) {
-  Vector2 scale = GetUIScale();
-  Vector2 offset = GetUIOffset();
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
   ::DrawTextureRec(
       texture,
       {position.x * scale.x + offset.x, position.y * scale.y + offset.y},
@@ -0,0 +1,615 @@
+#include "../../fumbo.hpp"
+#include "raymath.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Fumbo {
+namespace Graphic2D {
+
+namespace {
+
+float InverseMass(const Object *body) {
+  if (!body || body->GetBodyType() != BodyType::Dynamic)
+    return 0.0f;
+  return 1.0f / body->GetMass();
+}
+
+float BodyRotation(const Object *body) {
+  return body ? body->GetRotation() : 0.0f;
+}
+
+Vector2 WorldAnchor(const Object *body, Vector2 localAnchor) {
+  if (!body)
+    return localAnchor;
+  return Vector2Add(body->GetPosition(),
+                    Collision::RotatePoint(localAnchor, {0, 0},
+                                           body->GetRotation(),
+                                           body->UsesPortableTrig()));
+}
+
+Vector2 LocalAnchor(const Object *body, Vector2 worldAnchor) {
+  if (!body)
+    return worldAnchor;
+  return Collision::RotatePoint(
+      Vector2Subtract(worldAnchor, body->GetPosition()), {0, 0},
+      -body->GetRotation(), body->UsesPortableTrig());
+}
+
+Vector2 BodyPosition(const Object *body) {
+  return body ? body->GetPosition() : Vector2{0, 0};
+}
+
+Vector2 BodyVelocity(const Object *body) {
+  return body ? body->GetVelocity() : Vector2{0, 0};
+}
+
+// Angular velocity in radians per second
+float BodySpin(const Object *body) {
+  return body ? body->GetAngularVelocity() * DEG2RAD : 0.0f;
+}
+
+float Cross(Vector2 a, Vector2 b) { return a.x * b.y - a.y * b.x; }
+Vector2 Cross(float w, Vector2 r) { return {-w * r.y, w * r.x}; }
+
+// The two bodies of a joint with their inverse mass and inertia (0 =
+// immovable / doesn't turn) and the arms from each position to its anchor
+struct JointBodies {
+  Object *a;
+  Object *b;
+  float invMassA;
+  float invMassB;
+  float invInertiaA;
+  float invInertiaB;
+  Vector2 rA;
+  Vector2 rB;
+};
+
+// Bodies and masses; the arms are filled in by the callers below
+JointBodies GetBodyMasses(const Joint &joint) {
+  JointBodies bodies;
+  bodies.a = joint.bodyA;
+  bodies.b = joint.bodyB;
+  bodies.invMassA = InverseMass(joint.bodyA);
+  bodies.invMassB = InverseMass(joint.bodyB);
+  bodies.invInertiaA = joint.bodyA ? joint.bodyA->GetInverseInertia() : 0.0f;
+  bodies.invInertiaB = joint.bodyB ? joint.bodyB->GetInverseInertia() : 0.0f;
+  return bodies;
+}
+
+JointBodies GetBodies(const Joint &joint) {
+  JointBodies bodies = GetBodyMasses(joint);
+  bodies.rA = Vector2Subtract(WorldAnchor(joint.bodyA, joint.localAnchorA),
+                              BodyPosition(joint.bodyA));
+  bodies.rB = Vector2Subtract(WorldAnchor(joint.bodyB, joint.localAnchorB),
+                              BodyPosition(joint.bodyB));
+  return bodies;
+}
+
+// Velocity pass: nothing moves until it ends, so the arms WarmStartJoint
+// stored are reused instead of rotating the anchors again every sweep
+JointBodies GetVelocityBodies(const Joint &joint) {
+  JointBodies bodies = GetBodyMasses(joint);
+  bodies.rA = joint.armA;
+  bodies.rB = joint.armB;
+  return bodies;
+}
+
+// B's anchor minus A's anchor
+Vector2 AnchorDelta(const JointBodies &bodies) {
+  return Vector2Subtract(Vector2Add(BodyPosition(bodies.b), bodies.rB),
+                         Vector2Add(BodyPosition(bodies.a), bodies.rA));
+}
+
+bool BodyPortableTrig(const Object *body) {
+  return body && body->UsesPortableTrig();
+}
+
+Vector2 PrismaticAxis(const Joint &joint) {
+  return Collision::RotatePoint(Vector2Normalize(joint.localAxis), {0, 0},
+                                BodyRotation(joint.bodyA),
+                                BodyPortableTrig(joint.bodyA));
+}
+
+// Impulse `impulse` pushes B and pulls A; `angularA`/`angularB` are the
+// angular impulses it carries on each body
+void ApplyImpulse(const JointBodies &bodies, Vector2 impulse, float angularA,
+                  float angularB) {
+  if (bodies.invMassA > 0.0f) {
+    bodies.a->SetVelocity(Vector2Subtract(
+        bodies.a->GetVelocity(), Vector2Scale(impulse, bodies.invMassA)));
+    bodies.a->SetAngularVelocity(bodies.a->GetAngularVelocity() -
+                                 angularA * bodies.invInertiaA * RAD2DEG);
+  }
+  if (bodies.invMassB > 0.0f) {
+    bodies.b->SetVelocity(Vector2Add(bodies.b->GetVelocity(),
+                                     Vector2Scale(impulse, bodies.invMassB)));
+    bodies.b->SetAngularVelocity(bodies.b->GetAngularVelocity() +
+                                 angularB * bodies.invInertiaB * RAD2DEG);
+  }
+}
+
+// Same as ApplyImpulse, applied to positions and rotations (drift fix)
+void MoveBodies(const JointBodies &bodies, Vector2 impulse, float angularA,
+                float angularB) {
+  if (bodies.invMassA > 0.0f) {
+    bodies.a->SetPosition(Vector2Subtract(
+        bodies.a->GetPosition(), Vector2Scale(impulse, bodies.invMassA)));
+    bodies.a->SetRotation(bodies.a->GetRotation() -
+                          angularA * bodies.invInertiaA * RAD2DEG);
+  }
+  if (bodies.invMassB > 0.0f) {
+    bodies.b->SetPosition(Vector2Add(bodies.b->GetPosition(),
+                                     Vector2Scale(impulse, bodies.invMassB)));
+    bodies.b->SetRotation(bodies.b->GetRotation() +
+                          angularB * bodies.invInertiaB * RAD2DEG);
+  }
+}
+
+// One constrained direction: B's anchor along `axis`, with the lever arms
+// (cross products) that turn a push along it into spin on each body
+struct AxisConstraint {
+  Vector2 axis;
+  float armA;
+  float armB;
+};
+
+// Lever arms through the anchors (distance joints)
+AxisConstraint AnchorAxis(const JointBodies &bodies, Vector2 axis) {
+  return {axis, Cross(bodies.rA, axis), Cross(bodies.rB, axis)};
+}
+
+// Lever arms for a slider: A's arm reaches B's anchor so A turns with the
+// line it carries
+AxisConstraint SliderAxis(const JointBodies &bodies, Vector2 axis) {
+  Vector2 reach = Vector2Add(AnchorDelta(bodies), bodies.rA);
+  return {axis, Cross(reach, axis), Cross(bodies.rB, axis)};
+}
+
+float AxisMass(const JointBodies &bodies, const AxisConstraint &c) {
+  float k = bodies.invMassA + bodies.invMassB +
+            c.armA * c.armA * bodies.invInertiaA +
+            c.armB * c.armB * bodies.invInertiaB;
+  return k > 0.0f ? 1.0f / k : 0.0f;
+}
+
+float AxisVelocity(const JointBodies &bodies, const AxisConstraint &c) {
+  return Vector2DotProduct(Vector2Subtract(BodyVelocity(bodies.b),
+                                           BodyVelocity(bodies.a)),
+                           c.axis) +
+         c.armB * BodySpin(bodies.b) - c.armA * BodySpin(bodies.a);
+}
+
+void ApplyAxisImpulse(const JointBodies &bodies, const AxisConstraint &c,
+                      float lambda) {
+  ApplyImpulse(bodies, Vector2Scale(c.axis, lambda), lambda * c.armA,
+               lambda * c.armB);
+}
+
+void MoveAlongAxis(const JointBodies &bodies, const AxisConstraint &c,
+                   float lambda) {
+  MoveBodies(bodies, Vector2Scale(c.axis, lambda), lambda * c.armA,
+             lambda * c.armB);
+}
+
+// Most a point or angle constraint is corrected per position pass; larger
+// errors are closed over several passes instead of overshooting
+constexpr float MAX_POINT_CORRECTION = 16.0f;        // Pixels
+constexpr float MAX_ANGULAR_CORRECTION = 8 * DEG2RAD; // Radians
+
+// Solves K * x = rhs for the 2x2 point constraint mass matrix
+Vector2 SolvePointMass(const JointBodies &bodies, Vector2 rhs) {
+  float mass = bodies.invMassA + bodies.invMassB;
+  float iA = bodies.invInertiaA;
+  float iB = bodies.invInertiaB;
+  Vector2 rA = bodies.rA;
+  Vector2 rB = bodies.rB;
+
+  float k11 = mass + rA.y * rA.y * iA + rB.y * rB.y * iB;
+  float k12 = -rA.y * rA.x * iA - rB.y * rB.x * iB;
+  float k22 = mass + rA.x * rA.x * iA + rB.x * rB.x * iB;
+  float det = k11 * k22 - k12 * k12;
+  if (det == 0.0f)
+    return {0, 0};
+  det = 1.0f / det;
+  return {det * (k22 * rhs.x - k12 * rhs.y), det * (k11 * rhs.y - k12 * rhs.x)};
+}
+
+// Solves the 3x3 weld system (point plus relative angle) for the linear
+// and angular impulse or correction, so neither undoes the other. False
+// when neither body can turn; the point then goes through SolvePointMass.
+bool SolveWeldMass(const JointBodies &bodies, Vector2 rhs, float rhsAngle,
+                   Vector2 &impulse, float &angular) {
+  float mass = bodies.invMassA + bodies.invMassB;
+  float iA = bodies.invInertiaA;
+  float iB = bodies.invInertiaB;
+  Vector2 rA = bodies.rA;
+  Vector2 rB = bodies.rB;
+
+  float k11 = mass + rA.y * rA.y * iA + rB.y * rB.y * iB;
+  float k12 = -rA.y * rA.x * iA - rB.y * rB.x * iB;
+  float k13 = -rA.y * iA - rB.y * iB;
+  float k22 = mass + rA.x * rA.x * iA + rB.x * rB.x * iB;
+  float k23 = rA.x * iA + rB.x * iB;
+  float k33 = iA + iB;
+
+  // Cramer's rule on the symmetric matrix
+  float c11 = k22 * k33 - k23 * k23;
+  float c12 = k13 * k23 - k12 * k33;
+  float c13 = k12 * k23 - k13 * k22;
+  float det = k11 * c11 + k12 * c12 + k13 * c13;
+  if (k33 == 0.0f || det == 0.0f)
+    return false;
+  det = 1.0f / det;
+  float c22 = k11 * k33 - k13 * k13;
+  float c23 = k12 * k13 - k11 * k23;
+  float c33 = k11 * k22 - k12 * k12;
+  impulse = {det * (c11 * rhs.x + c12 * rhs.y + c13 * rhsAngle),
+             det * (c12 * rhs.x + c22 * rhs.y + c23 * rhsAngle)};
+  angular = det * (c13 * rhs.x + c23 * rhs.y + c33 * rhsAngle);
+  return true;
+}
+
+void ApplyPointImpulse(const JointBodies &bodies, Vector2 impulse) {
+  ApplyImpulse(bodies, impulse, Cross(bodies.rA, impulse),
+               Cross(bodies.rB, impulse));
+}
+
+// Distance/rope axis; false when the anchors coincide or a rope is slack
+bool DistanceAxis(const Joint &joint, const JointBodies &bodies,
+                  AxisConstraint &c, float &error) {
+  Vector2 delta = AnchorDelta(bodies);
+  float length = Vector2Length(delta);
+  if (length < 0.0001f)
+    return false;
+  c = AnchorAxis(bodies, Vector2Scale(delta, 1.0f / length));
+  error = length - joint.length;
+  return joint.type != JointType::Rope || error >= 0.0f;
+}
+
+// Anchor velocity of B relative to A
+Vector2 PointVelocity(const JointBodies &bodies) {
+  return Vector2Subtract(
+      Vector2Add(BodyVelocity(bodies.b), Cross(BodySpin(bodies.b), bodies.rB)),
+      Vector2Add(BodyVelocity(bodies.a), Cross(BodySpin(bodies.a), bodies.rA)));
+}
+
+// Anchor error clamped to MAX_POINT_CORRECTION
+Vector2 PointError(const JointBodies &bodies) {
+  Vector2 error = AnchorDelta(bodies);
+  float length = Vector2Length(error);
+  if (length > MAX_POINT_CORRECTION) {
+    error = Vector2Scale(error, MAX_POINT_CORRECTION / length);
+  }
+  return error;
+}
+
+// Velocity pass
+
+// Share of a rotation lock's total carried into the next step. Re-applying
+// all of it blows up long welded chains once they whip around: the stale
+// torque adds more than a few sweeps can take back out.
+constexpr float ANGULAR_WARM_START = 0.5f;
+
+// Re-applies last step's impulses so long chains start each step near
+// their converged tension instead of rebuilding it from zero
+void WarmStartJoint(Joint &joint) {
+  JointBodies bodies = GetBodies(joint);
+  joint.armA = bodies.rA;
+  joint.armB = bodies.rB;
+  joint.angularImpulse *= ANGULAR_WARM_START;
+  if (bodies.invMassA + bodies.invMassB <= 0.0f)
+    return;
+
+  switch (joint.type) {
+  case JointType::Distance:
+  case JointType::Rope: {
+    AxisConstraint c;
+    float error;
+    if (!DistanceAxis(joint, bodies, c, error)) {
+      joint.impulse = {0, 0};
+      return;
+    }
+    ApplyAxisImpulse(bodies, c, joint.impulse.x);
+    break;
+  }
+  case JointType::Revolute:
+    ApplyPointImpulse(bodies, joint.impulse);
+    break;
+  case JointType::Weld:
+    ApplyImpulse(bodies, joint.impulse,
+                 Cross(bodies.rA, joint.impulse) + joint.angularImpulse,
+                 Cross(bodies.rB, joint.impulse) + joint.angularImpulse);
+    break;
+  case JointType::Prismatic: {
+    Vector2 axis = PrismaticAxis(joint);
+    AxisConstraint c = SliderAxis(bodies, {-axis.y, axis.x});
+    ApplyImpulse(bodies, Vector2Scale(c.axis, joint.impulse.x),
+                 joint.impulse.x * c.armA + joint.angularImpulse,
+                 joint.impulse.x * c.armB + joint.angularImpulse);
+    break;
+  }
+  }
+}
+
+void SolveJointVelocity(Joint &joint) {
+  JointBodies bodies = GetVelocityBodies(joint);
+  if (bodies.invMassA + bodies.invMassB <= 0.0f)
+    return; // Nothing can move
+
+  switch (joint.type) {
+  case JointType::Distance:
+  case JointType::Rope: {
+    AxisConstraint c;
+    float error;
+    if (!DistanceAxis(joint, bodies, c, error))
+      break;
+
+    float impulse = -AxisVelocity(bodies, c) * AxisMass(bodies, c);
+    if (joint.type == JointType::Rope) {
+      // Ropes only pull: the total stays <= 0
+      float previous = joint.impulse.x;
+      joint.impulse.x = fminf(previous + impulse, 0.0f);
+      impulse = joint.impulse.x - previous;
+    } else {
+      joint.impulse.x += impulse;
+    }
+    ApplyAxisImpulse(bodies, c, impulse);
+    break;
+  }
+
+  case JointType::Revolute:
+  case JointType::Weld: {
+    // Welds solve the point and the rotation lock together, so the two
+    // totals can't grow against each other
+    float spin = BodySpin(bodies.b) - BodySpin(bodies.a);
+    Vector2 impulse;
+    float angular = 0.0f;
+    if (!(joint.type == JointType::Weld &&
+          SolveWeldMass(bodies, Vector2Negate(PointVelocity(bodies)), -spin,
+                        impulse, angular))) {
+      impulse = SolvePointMass(bodies, Vector2Negate(PointVelocity(bodies)));
+    }
+    joint.impulse = Vector2Add(joint.impulse, impulse);
+    joint.angularImpulse += angular;
+    ApplyImpulse(bodies, impulse, Cross(bodies.rA, impulse) + angular,
+                 Cross(bodies.rB, impulse) + angular);
+    break;
+  }
+
+  case JointType::Prismatic: {
+    // Off-axis motion and the rotation lock as one 2x2 block, for the same
+    // reason. Limits are left to the position pass; they engage and
+    // release too often to warm start.
+    Vector2 axis = PrismaticAxis(joint);
+    AxisConstraint c = SliderAxis(bodies, {-axis.y, axis.x});
+    float k11 = bodies.invMassA + bodies.invMassB +
+                c.armA * c.armA * bodies.invInertiaA +
+                c.armB * c.armB * bodies.invInertiaB;
+    float k12 = c.armA * bodies.invInertiaA + c.armB * bodies.invInertiaB;
+    float k22 = bodies.invInertiaA + bodies.invInertiaB;
+    float velocity = AxisVelocity(bodies, c);
+    float spin = BodySpin(bodies.b) - BodySpin(bodies.a);
+    float det = k11 * k22 - k12 * k12;
+    float impulse, angular = 0.0f;
+    if (k22 > 0.0f && det != 0.0f) {
+      impulse = (k12 * spin - k22 * velocity) / det;
+      angular = (k12 * velocity - k11 * spin) / det;
+    } else {
+      impulse = -velocity * AxisMass(bodies, c);
+    }
+    joint.impulse.x += impulse;
+    joint.angularImpulse += angular;
+    ApplyImpulse(bodies, Vector2Scale(c.axis, impulse),
+                 impulse * c.armA + angular, impulse * c.armB + angular);
+    break;
+  }
+  }
+}
+
+// Position pass
+
+void SolveJointPosition(Joint &joint) {
+  JointBodies bodies = GetBodies(joint);
+  if (bodies.invMassA + bodies.invMassB <= 0.0f)
+    return;
+
+  // Hold rotation B - A at the reference angle (radians, clamped like the
+  // point error)
+  float angleError = (BodyRotation(bodies.b) - BodyRotation(bodies.a) -
+                      joint.referenceAngle) *
+                     DEG2RAD;
+  angleError = fminf(fmaxf(angleError, -MAX_ANGULAR_CORRECTION),
+                     MAX_ANGULAR_CORRECTION);
+  float angularMass = bodies.invInertiaA + bodies.invInertiaB;
+  if (joint.type == JointType::Prismatic && angularMass > 0.0f) {
+    float lambda = -angleError * joint.stiffness / angularMass;
+    MoveBodies(bodies, {0, 0}, lambda, lambda);
+    bodies = GetBodies(joint); // Arms rotated with the bodies
+  }
+
+  switch (joint.type) {
+  case JointType::Distance:
+  case JointType::Rope: {
+    AxisConstraint c;
+    float error;
+    if (DistanceAxis(joint, bodies, c, error)) {
+      MoveAlongAxis(bodies, c, -error * joint.stiffness * AxisMass(bodies, c));
+    }
+    break;
+  }
+
+  case JointType::Revolute:
+  case JointType::Weld: {
+    // The mass matrix counts on the bodies turning, so the correction has
+    // to turn them too; moving alone undershoots and long chains drift
+    // apart. Welds correct the angle in the same solve so the two don't
+    // undo each other.
+    Vector2 error = PointError(bodies);
+    Vector2 impulse;
+    float angular = 0.0f;
+    if (!(joint.type == JointType::Weld &&
+          SolveWeldMass(bodies, Vector2Negate(error), -angleError, impulse,
+                        angular))) {
+      impulse = SolvePointMass(bodies, Vector2Negate(error));
+    }
+    impulse = Vector2Scale(impulse, joint.stiffness);
+    angular *= joint.stiffness;
+    MoveBodies(bodies, impulse, Cross(bodies.rA, impulse) + angular,
+               Cross(bodies.rB, impulse) + angular);
+    break;
+  }
+
+  case JointType::Prismatic: {
+    Vector2 axis = PrismaticAxis(joint);
+    Vector2 delta = AnchorDelta(bodies);
+
+    // Stay on the axis line
+    AxisConstraint c = SliderAxis(bodies, {-axis.y, axis.x});
+    MoveAlongAxis(bodies, c,
+                  -Vector2DotProduct(delta, c.axis) * joint.stiffness *
+                      AxisMass(bodies, c));
+
+    if (joint.enableLimit) {
+      float translation = Vector2DotProduct(delta, axis);
+      float limit = fminf(fmaxf(translation, joint.lowerTranslation),
+                          joint.upperTranslation);
+      if (translation != limit) {
+        AxisConstraint slide = SliderAxis(bodies, axis);
+        float mass = AxisMass(bodies, slide);
+        MoveAlongAxis(bodies, slide,
+                      -(translation - limit) * joint.stiffness * mass);
+
+        // Stop motion into the limit
+        float velocity = AxisVelocity(bodies, slide);
+        if ((translation > limit) == (velocity > 0.0f)) {
+          ApplyAxisImpulse(bodies, slide, -velocity * mass);
+        }
+      }
+    }
+    break;
+  }
+  }
+}
+
+} // namespace
+
+// Joint builders
+
+Joint MakeDistanceJoint(Object *a, Object *b, Vector2 anchorA,
+                        Vector2 anchorB) {
+  Joint joint;
+  joint.type = JointType::Distance;
+  joint.bodyA = a;
+  joint.bodyB = b;
+  joint.localAnchorA = LocalAnchor(a, anchorA);
+  joint.localAnchorB = LocalAnchor(b, anchorB);
+  joint.length = Vector2Distance(anchorA, anchorB);
+  return joint;
+}
+
+Joint MakeRopeJoint(Object *a, Object *b, Vector2 anchorA, Vector2 anchorB,
+                    float maxLength) {
+  Joint joint = MakeDistanceJoint(a, b, anchorA, anchorB);
+  joint.type = JointType::Rope;
+  joint.length = maxLength;
+  return joint;
+}
+
+Joint MakeRevoluteJoint(Object *a, Object *b, Vector2 anchor) {
+  Joint joint;
+  joint.type = JointType::Revolute;
+  joint.bodyA = a;
+  joint.bodyB = b;
+  joint.localAnchorA = LocalAnchor(a, anchor);
+  joint.localAnchorB = LocalAnchor(b, anchor);
+  return joint;
+}
+
+Joint MakeWeldJoint(Object *a, Object *b, Vector2 anchor) {
+  Joint joint = MakeRevoluteJoint(a, b, anchor);
+  joint.type = JointType::Weld;
+  joint.referenceAngle = BodyRotation(b) - BodyRotation(a);
+  return joint;
+}
+
+Joint MakePrismaticJoint(Object *a, Object *b, Vector2 anchor, Vector2 axis) {
+  Joint joint = MakeRevoluteJoint(a, b, anchor);
+  joint.type = JointType::Prismatic;
+  joint.localAxis = Collision::RotatePoint(Vector2Normalize(axis), {0, 0},
+                                           -BodyRotation(a),
+                                           BodyPortableTrig(a));
+  joint.referenceAngle = BodyRotation(b) - BodyRotation(a);
+  return joint;
+}
+
+// Joint Management
+
+void Physics::AddJoint(Joint *joint) {
+  if (!joint || joint->world == this)
+    return;
+
+  if (joint->world) {
+    joint->world->RemoveJoint(joint);
+  }
+
+  joint->world = this;
+  joint->worldSlot = (uint32_t)joints.size();
+  joint->impulse = {0, 0};
+  joint->angularImpulse = 0.0f;
+  joints.push_back(joint);
+}
+
+void Physics::RemoveJoint(Joint *joint) {
+  if (!joint || joint->world != this)
+    return;
+
+  // Swap-remove, like RemoveObject
+  Joint *last = joints.back();
+  joints[joint->worldSlot] = last;
+  last->worldSlot = joint->worldSlot;
+  joints.pop_back();
+
+  joint->world = nullptr;
+}
+
+void Physics::BuildJointFilter() {
+  jointFilter.clear();
+  for (const auto *joint : joints) {
+    if (joint->collideConnected || !joint->bodyA || !joint->bodyB)
+      continue;
+
+    // Same key layout as collision pairs: lower id in the high bits
+    uint64_t idA = joint->bodyA->GetId();
+    uint64_t idB = joint->bodyB->GetId();
+    if (idB < idA)
+      std::swap(idA, idB);
+    jointFilter.push_back((idA << 32) | idB);
+  }
+  std::sort(jointFilter.begin(), jointFilter.end());
+}
+
+void Physics::WarmStartJoints(float ratio) {
+  for (auto *joint : joints) {
+    // Impulses scale with the step length when sub-stepping changes it
+    joint->impulse = Vector2Scale(joint->impulse, ratio);
+    joint->angularImpulse *= ratio;
+    WarmStartJoint(*joint);
+  }
+}
+
+void Physics::SolveJointVelocities(bool reverse) {
+  size_t count = joints.size();
+  for (size_t i = 0; i < count; i++) {
+    SolveJointVelocity(*joints[reverse ? count - 1 - i : i]);
+  }
+}
+
+void Physics::SolveJointPositions(bool reverse) {
+  size_t count = joints.size();
+  for (size_t i = 0; i < count; i++) {
+    SolveJointPosition(*joints[reverse ? count - 1 - i : i]);
+  }
+}
+
+} // namespace Graphic2D
+} // namespace Fumbo
@@ -8,6 +8,7 @@ namespace Graphic2D {
 Object::Object()
     : shapeType(ShapeType::Rectangle), width(100.0f), height(100.0f),
       radius(50.0f), position({0, 0}), rotation(0.0f), scale(1.0f),
+      previousPosition({0, 0}), previousRotation(0.0f),
       bodyType(BodyType::Dynamic), velocity({0, 0}), acceleration({0, 0}),
       mass(1.0f), friction(0.3f), drag(0.01f), restitution(0.5f),
       gravityScale(1.0f), isTrigger(false), color(BLUE), isOutline(false),
@@ -19,11 +20,13 @@ void Object::SetRectangle(float w, float h) {
   shapeType = ShapeType::Rectangle;
   width = w;
   height = h;
+  ComputeUnitInertia();
 }
 
 void Object::SetCircle(float r) {
   shapeType = ShapeType::Circle;
   radius = r;
+  ComputeUnitInertia();
 }
 
 void Object::SetTriangle(Vector2 p1, Vector2 p2, Vector2 p3) {
@@ -32,17 +35,88 @@ void Object::SetTriangle(Vector2 p1, Vector2 p2, Vector2 p3) {
   vertices.push_back(p1);
   vertices.push_back(p2);
   vertices.push_back(p3);
+  normals.resize(vertices.size());
+  Collision::ComputeEdgeNormals(vertices.data(), (int)vertices.size(),
+                                normals.data());
+  pieces.clear();
+  pieceVertices.clear();
+  pieceNormals.clear();
+  ComputeUnitInertia();
 }
 
 void Object::SetPolygon(const std::vector<Vector2> &verts) {
   shapeType = ShapeType::Polygon;
   vertices = verts;
+  normals.resize(vertices.size());
+  Collision::ComputeEdgeNormals(vertices.data(), (int)vertices.size(),
+                                normals.data());
+
+  pieces.clear();
+  pieceVertices.clear();
+  pieceNormals.clear();
+  ComputeUnitInertia();
+  if (Collision::IsConvex(vertices))
+    return;
+
+  for (const auto &piece : Collision::DecomposeConvex(vertices)) {
+    int first = (int)pieceVertices.size();
+    int count = (int)piece.size();
+    pieces.push_back({first, count});
+    pieceVertices.insert(pieceVertices.end(), piece.begin(), piece.end());
+    pieceNormals.resize(pieceVertices.size());
+    Collision::ComputeEdgeNormals(piece.data(), count,
+                                  pieceNormals.data() + first);
+  }
+}
+
+Collision::PolygonView Object::GetLocalConvexPiece(int index) const {
+  if (pieces.empty())
+    return {vertices.data(), normals.data(), (int)vertices.size()};
+  const ConvexPiece &piece = pieces[index];
+  return {pieceVertices.data() + piece.first,
+          pieceNormals.data() + piece.first, piece.count};
 }
 
 void Object::SetLine(Vector2 start, Vector2 end) {
   shapeType = ShapeType::Line;
   lineStart = start;
   lineEnd = end;
+  ComputeUnitInertia();
+}
+
+void Object::ComputeUnitInertia() {
+  verticesCached = false; // Shape changed
+
+  switch (shapeType) {
+  case ShapeType::Rectangle:
+    unitInertia = (width * width + height * height) / 12.0f;
+    break;
+  case ShapeType::Circle:
+    unitInertia = radius * radius * 0.5f;
+    break;
+  case ShapeType::Triangle:
+  case ShapeType::Polygon: {
+    // Solid polygon about the local origin (the body's position), summed
+    // over the triangles fanned from it; works for concave outlines too
+    float weighted = 0.0f;
+    float doubleArea = 0.0f;
+    for (size_t i = 0; i < vertices.size(); i++) {
+      Vector2 p1 = vertices[i];
+      Vector2 p2 = vertices[(i + 1) % vertices.size()];
+      float cross = p1.x * p2.y - p1.y * p2.x;
+      weighted += cross * (Vector2DotProduct(p1, p1) +
+                           Vector2DotProduct(p1, p2) +
+                           Vector2DotProduct(p2, p2));
+      doubleArea += cross;
+    }
+    unitInertia =
+        fabsf(doubleArea) > 0.0001f ? weighted / (6.0f * doubleArea) : 0.0f;
+    break;
+  }
+  case ShapeType::Line:
+    unitInertia = 0.0f; // Lines collide without rotation
+    break;
+  }
 }
 
 // ===== Physics Simulation =====
@@ -53,54 +127,146 @@ void Object::ApplyForce(Vector2 force) {
   }
 }
 
+void Object::ApplyForceAtPoint(Vector2 force, Vector2 point) {
+  ApplyForce(force);
+  Vector2 arm = Vector2Subtract(point, position);
+  ApplyTorque(arm.x * force.y - arm.y * force.x);
+}
+
+void Object::ApplyTorque(float t) {
+  if (bodyType == BodyType::Dynamic) {
+    torque += t;
+  }
+}
+
 void Object::ApplyImpulse(Vector2 impulse) {
   if (bodyType == BodyType::Dynamic) {
     velocity = Vector2Add(velocity, Vector2Scale(impulse, 1.0f / mass));
   }
 }
 
+void Object::ApplyImpulseAtPoint(Vector2 impulse, Vector2 point) {
+  ApplyImpulse(impulse);
+  Vector2 arm = Vector2Subtract(point, position);
+  angularVelocity += (arm.x * impulse.y - arm.y * impulse.x) *
+                     GetInverseInertia() * RAD2DEG;
+}
+
+float Object::GetInertia() const {
+  return mass * unitInertia * scale * scale;
+}
+
+float Object::GetInverseInertia() const {
+  if (bodyType != BodyType::Dynamic || fixedRotation)
+    return 0.0f;
+  float inertia = GetInertia();
+  return inertia > 0.0f ? 1.0f / inertia : 0.0f;
+}
+
 void Object::Update(float deltaTime) {
-  if (bodyType == BodyType::Static)
+  IntegrateVelocity(deltaTime);
+  IntegratePosition(deltaTime);
+}
+
+void Object::IntegrateVelocity(float deltaTime) {
+  // Static bodies never move, kinematic bodies are moved by game code
+  if (bodyType != BodyType::Dynamic)
     return;
 
   // Apply drag
   velocity = Vector2Scale(velocity, 1.0f - drag * deltaTime);
+  angularVelocity *= 1.0f - drag * deltaTime;
 
   // Update velocity from acceleration
   velocity = Vector2Add(velocity, Vector2Scale(acceleration, deltaTime));
-
-  // Update position from velocity
-  position = Vector2Add(position, Vector2Scale(velocity, deltaTime));
+  angularVelocity += torque * GetInverseInertia() * RAD2DEG * deltaTime;
+  if (fixedRotation) {
+    angularVelocity = 0.0f;
+  }
 
   // Reset acceleration
   acceleration = {0, 0};
+  torque = 0.0f;
+}
 
-  // Update vertices if needed
-  if (shapeType == ShapeType::Polygon || shapeType == ShapeType::Triangle) {
-    UpdateVertices();
-  }
+void Object::IntegratePosition(float deltaTime) {
+  if (bodyType != BodyType::Dynamic)
+    return;
+
+  // Update position from velocity
+  position = Vector2Add(position, Vector2Scale(velocity, deltaTime));
+  rotation += angularVelocity * deltaTime;
 }
 
 // ===== Shape-Specific Getters =====
 
-std::vector<Vector2> Object::GetVertices() const {
+const std::vector<Vector2> &Object::GetVertices() const {
+  UpdateVertices();
+  return worldVertices;
+}
+
+std::vector<Vector2> Object::GetVerticesAt(Vector2 pos, float rot) const {
   if (shapeType == ShapeType::Polygon || shapeType == ShapeType::Triangle) {
     // Transform vertices to world space
     std::vector<Vector2> worldVerts;
     for (const auto &v : vertices) {
       Vector2 scaled = Vector2Scale(v, scale);
-      Vector2 rotated = Collision::RotatePoint(scaled, {0, 0}, rotation);
-      worldVerts.push_back(Vector2Add(rotated, position));
+      Vector2 rotated =
+          Collision::RotatePoint(scaled, {0, 0}, rot, UsesPortableTrig());
+      worldVerts.push_back(Vector2Add(rotated, pos));
     }
     return worldVerts;
   } else if (shapeType == ShapeType::Rectangle) {
-    return Collision::GetRectangleVertices(position, width * scale,
-                                           height * scale, rotation);
+    return Collision::GetRectangleVertices(pos, width * scale, height * scale,
+                                           rot, UsesPortableTrig());
   }
   return {};
 }
 
+// ===== Interpolation =====
+
+void Object::ResetInterpolation() {
+  previousPosition = position;
+  previousRotation = rotation;
+}
+
+Vector2 Object::GetInterpolatedPosition() const {
+  // Only dynamic bodies move inside the fixed step; static and kinematic
+  // bodies are placed by game code and are already current
+  if (!world || bodyType != BodyType::Dynamic)
+    return position;
+  return Vector2Lerp(previousPosition, position,
+                     world->GetInterpolationAlpha());
+}
+
+float Object::GetInterpolatedRotation() const {
+  if (!world || bodyType != BodyType::Dynamic)
+    return rotation;
+  return Lerp(previousRotation, rotation, world->GetInterpolationAlpha());
+}
+
+Rectangle Object::GetInterpolatedAABB() const {
+  Rectangle aabb = GetShapeAABB();
+  Vector2 renderPos = GetInterpolatedPosition();
+  aabb.x += renderPos.x - position.x;
+  aabb.y += renderPos.y - position.y;
+  return aabb;
+}
+
 Rectangle Object::GetAABB() const {
+  Rectangle aabb = GetShapeAABB();
+  for (int i = 1; i <= extraFixtureCount; i++) {
+    Rectangle box = GetFixtureAABB(i);
+    float minX = fminf(aabb.x, box.x);
+    float minY = fminf(aabb.y, box.y);
+    float maxX = fmaxf(aabb.x + aabb.width, box.x + box.width);
+    float maxY = fmaxf(aabb.y + aabb.height, box.y + box.height);
+    aabb = {minX, minY, maxX - minX, maxY - minY};
+  }
+  return aabb;
+}
+
+Rectangle Object::GetShapeAABB() const {
   switch (shapeType) {
   case ShapeType::Rectangle: {
     // For non-rotated rectangles, AABB is simple
@@ -111,7 +277,7 @@ Rectangle Object::GetAABB() const {
               height * scale};
     }
     // For rotated rectangles, get bounding box of vertices
-    auto verts = GetVertices();
+    const auto &verts = GetVertices();
     return Collision::GetBoundingBox(verts);
   }
 
@@ -122,7 +288,7 @@ Rectangle Object::GetAABB() const {
 
   case ShapeType::Triangle:
   case ShapeType::Polygon: {
-    auto verts = GetVertices();
+    const auto &verts = GetVertices();
     return Collision::GetBoundingBox(verts);
   }
 
@@ -133,7 +299,9 @@ Rectangle Object::GetAABB() const {
     float maxX = fmaxf(worldStart.x, worldEnd.x);
     float minY = fminf(worldStart.y, worldEnd.y);
     float maxY = fmaxf(worldStart.y, worldEnd.y);
-    return {minX, minY, maxX - minX, maxY - minY};
+    // Lines collide as capsules, so pad by half the thickness
+    float r = thickness * 0.5f;
+    return {minX - r, minY - r, maxX - minX + 2 * r, maxY - minY + 2 * r};
   }
   }
 
@@ -143,11 +311,16 @@ Rectangle Object::GetAABB() const {
 // ===== Rendering =====
 
 void Object::Render() const {
+  // Draw at the interpolated transform so motion stays smooth between fixed
+  // physics steps
+  Vector2 renderPos = GetInterpolatedPosition();
+  float renderRot = GetInterpolatedRotation();
+
   switch (shapeType) {
   case ShapeType::Rectangle: {
-    if (rotation == 0.0f) {
-      Rectangle rect = {position.x - (width * scale) / 2,
-                        position.y - (height * scale) / 2, width * scale,
+    if (renderRot == 0.0f) {
+      Rectangle rect = {renderPos.x - (width * scale) / 2,
+                        renderPos.y - (height * scale) / 2, width * scale,
                         height * scale};
 
       if (hasTexture) {
@@ -166,15 +339,15 @@ void Object::Render() const {
 
       if (hasTexture) {
         // Draw rotated texture
-        Rectangle dest = {position.x, position.y, width * scale,
+        Rectangle dest = {renderPos.x, renderPos.y, width * scale,
                           height * scale};
         Rectangle source = {0, 0, (float)texture.width, (float)texture.height};
         Fumbo::Graphic2D::DrawTexturePro(texture, source, dest, origin,
-                                         rotation, WHITE);
+                                         renderRot, WHITE);
       } else if (isOutline) {
-        Fumbo::Graphic2D::DrawRectanglePro(rect, origin, rotation, BLANK);
+        Fumbo::Graphic2D::DrawRectanglePro(rect, origin, renderRot, BLANK);
         // Draw outline manually with lines
-        auto verts = GetVertices();
+        auto verts = GetVerticesAt(renderPos, renderRot);
         for (size_t i = 0; i < verts.size(); i++) {
           Vector2 p1 = verts[i];
           Vector2 p2 = verts[(i + 1) % verts.size()];
@@ -182,8 +355,8 @@ void Object::Render() const {
         }
       } else {
         Fumbo::Graphic2D::DrawRectanglePro(
-            {position.x, position.y, width * scale, height * scale}, origin,
-            rotation, color);
+            {renderPos.x, renderPos.y, width * scale, height * scale}, origin,
+            renderRot, color);
       }
     }
     break;
@@ -191,17 +364,17 @@ void Object::Render() const {
 
   case ShapeType::Circle: {
     if (isOutline) {
-      Fumbo::Graphic2D::DrawCircleLines(position.x, position.y, radius * scale,
-                                        color);
+      Fumbo::Graphic2D::DrawCircleLines(renderPos.x, renderPos.y,
+                                        radius * scale, color);
     } else {
-      Fumbo::Graphic2D::DrawCircleV(position, radius * scale, color);
+      Fumbo::Graphic2D::DrawCircleV(renderPos, radius * scale, color);
     }
     break;
   }
 
   case ShapeType::Triangle: {
     if (vertices.size() >= 3) {
-      auto worldVerts = GetVertices();
+      auto worldVerts = GetVerticesAt(renderPos, renderRot);
       if (isOutline) {
         Fumbo::Graphic2D::DrawTriangleLines(worldVerts[0], worldVerts[1],
                                             worldVerts[2], color);
@@ -214,7 +387,7 @@ void Object::Render() const {
   }
 
   case ShapeType::Polygon: {
-    auto worldVerts = GetVertices();
+    auto worldVerts = GetVerticesAt(renderPos, renderRot);
     if (worldVerts.size() >= 3) {
       if (isOutline) {
         for (size_t i = 0; i < worldVerts.size(); i++) {
@@ -222,6 +395,23 @@ void Object::Render() const {
           Vector2 p2 = worldVerts[(i + 1) % worldVerts.size()];
           Fumbo::Graphic2D::DrawLineEx(p1, p2, thickness, color);
         }
+      } else if (!pieces.empty()) {
+        // Concave: fan each convex piece
+        for (const auto &piece : pieces) {
+          Vector2 first;
+          Vector2 prev;
+          for (int i = 0; i < piece.count; i++) {
+            Vector2 v = Vector2Scale(pieceVertices[piece.first + i], scale);
+            v = Vector2Add(Collision::RotatePoint(v, {0, 0}, renderRot,
+                                                  UsesPortableTrig()),
+                           renderPos);
+            if (i == 0)
+              first = v;
+            else if (i >= 2)
+              Fumbo::Graphic2D::DrawTriangle(first, prev, v, color);
+            prev = v;
+          }
+        }
       } else {
         // Draw filled polygon using triangle fan
         for (size_t i = 1; i < worldVerts.size() - 1; i++) {
@@ -234,8 +424,8 @@ void Object::Render() const {
   }
 
   case ShapeType::Line: {
-    Vector2 worldStart = Vector2Add(position, lineStart);
-    Vector2 worldEnd = Vector2Add(position, lineEnd);
+    Vector2 worldStart = Vector2Add(renderPos, lineStart);
+    Vector2 worldEnd = Vector2Add(renderPos, lineEnd);
     Fumbo::Graphic2D::DrawLineEx(worldStart, worldEnd, thickness, color);
     break;
   }
@@ -244,7 +434,7 @@ void Object::Render() const {
 
 void Object::DrawDebug() const {
   // Draw bounding box
-  auto verts = GetVertices();
+  const auto &verts = GetVertices();
   if (!verts.empty()) {
     Rectangle bounds = Collision::GetBoundingBox(verts);
     Fumbo::Graphic2D::DrawRectangleLinesEx(bounds, 1.0f, YELLOW);
@@ -254,26 +444,180 @@ void Object::DrawDebug() const {
   }
 
   // Draw velocity vector
-  if (bodyType == BodyType::Dynamic) {
+  if (bodyType != BodyType::Static) {
     Vector2 velEnd = Vector2Add(position, Vector2Scale(velocity, 0.1f));
     Fumbo::Graphic2D::DrawLineEx(position, velEnd, 2.0f, GREEN);
     Fumbo::Graphic2D::DrawCircleV(velEnd, 4.0f, GREEN);
   }
 
+  // Draw fixtures (triggers in green)
+  for (int i = 1; i <= extraFixtureCount; i++) {
+    Color fixtureColor = IsFixtureTrigger(i) ? GREEN : MAGENTA;
+    const Fixture &fixture = GetFixture(i);
+    Object shape;
+    MakeFixtureShape(i, shape);
+    if (fixture.shape == ShapeType::Circle) {
+      Fumbo::Graphic2D::DrawCircleLines(shape.position.x, shape.position.y,
+                                        fixture.radius * scale, fixtureColor);
+    } else {
+      const auto &fixtureVerts = shape.GetVertices();
+      for (size_t v = 0; v < fixtureVerts.size(); v++) {
+        Fumbo::Graphic2D::DrawLineEx(
+            fixtureVerts[v], fixtureVerts[(v + 1) % fixtureVerts.size()],
+            1.0f, fixtureColor);
+      }
+    }
+  }
+
   // Draw center point
   Fumbo::Graphic2D::DrawCircleV(position, 3.0f, RED);
 
   // Draw body type text
-  const char *typeText = (bodyType == BodyType::Static) ? "STATIC" : "DYNAMIC";
+  const char *typeText = "DYNAMIC";
+  Color typeColor = LIME;
+  if (bodyType == BodyType::Static) {
+    typeText = "STATIC";
+    typeColor = ORANGE;
+  } else if (bodyType == BodyType::Kinematic) {
+    typeText = "KINEMATIC";
+    typeColor = SKYBLUE;
+  }
   Fumbo::Graphic2D::DrawText(typeText, {(position.x - 20), (position.y - 30)},
-                             {}, 10,
-                             (bodyType == BodyType::Static) ? ORANGE : LIME);
+                             {}, 10, typeColor);
+}
+
+bool Object::UsesPortableTrig() const {
+  return portableTrig || (world && world->IsDeterministic());
 }
 
-void Object::UpdateVertices() {
-  // This is called internally to update polygon/triangle transforms
-  // The actual transformation is done in GetVe  DrawCircleLines(position.x,
-  // position.y, 5, RED);
+void Object::UpdateVertices() const {
+  // The world's trig mode is part of the key: joining or leaving a
+  // deterministic world rebuilds the vertices
+  bool portable = UsesPortableTrig();
+  if (verticesCached && cachedPosition.x == position.x &&
+      cachedPosition.y == position.y && cachedRotation == rotation &&
+      cachedScale == scale && cachedPortable == portable)
+    return;
+
+  // Written in place: after the first build the buffer only changes size
+  // with the shape, so refreshing it never allocates
+  const Vector2 *local = vertices.data();
+  size_t count = vertices.size();
+  Vector2 corners[4];
+  if (shapeType == ShapeType::Rectangle) {
+    // Same corner order as Collision::GetRectangleVertices
+    float halfW = width / 2;
+    float halfH = height / 2;
+    corners[0] = {-halfW, -halfH};
+    corners[1] = {halfW, -halfH};
+    corners[2] = {halfW, halfH};
+    corners[3] = {-halfW, halfH};
+    local = corners;
+    count = 4;
+  } else if (shapeType != ShapeType::Polygon &&
+             shapeType != ShapeType::Triangle) {
+    count = 0;
+  }
+
+  // One sin/cos for the whole outline ({cos, sin} of the rotation)
+  Vector2 axis = {1, 0};
+  if (rotation != 0.0f)
+    axis = Collision::RotatePoint({1, 0}, {0, 0}, rotation, portable);
+  worldVertices.resize(count);
+  for (size_t i = 0; i < count; i++) {
+    Vector2 scaled = Vector2Scale(local[i], scale);
+    Vector2 rotated = {scaled.x * axis.x - scaled.y * axis.y,
+                       scaled.x * axis.y + scaled.y * axis.x};
+    worldVertices[i] = Vector2Add(rotated, position);
+  }
+
+  cachedPosition = position;
+  cachedRotation = rotation;
+  cachedScale = scale;
+  cachedPortable = portable;
+  verticesCached = true;
+}
+
+// ===== Fixtures =====
+
+int Object::AddFixture(const Fixture &fixture) {
+  if (extraFixtureCount >= MAX_FIXTURES)
+    return -1;
+  fixtures[extraFixtureCount++] = fixture;
+  return extraFixtureCount;
+}
+
+bool Object::IsFixtureTrigger(int index) const {
+  if (isTrigger)
+    return true;
+  return index > 0 && GetFixture(index).isTrigger;
+}
+
+bool Object::IsFixtureCollidingWith(int index, const Object *other) const {
+  if (!other)
+    return false;
+
+  Object shape;
+  const Object *self = this;
+  if (index > 0) {
+    MakeFixtureShape(index, shape);
+    self = &shape;
+  }
+
+  // Against each of the other object's fixtures
+  Object otherShape;
+  for (int i = 0; i < other->GetFixtureCount(); i++) {
+    const Object *target = other;
+    if (i > 0) {
+      other->MakeFixtureShape(i, otherShape);
+      target = &otherShape;
+    }
+    if (Collision::CheckShapeCollision(self, target).hasCollision)
+      return true;
+  }
+  return false;
+}
+
+Rectangle Object::GetFixtureAABB(int index) const {
+  if (index == 0)
+    return GetShapeAABB();
+
+  const Fixture &fixture = GetFixture(index);
+  Vector2 center = Vector2Add(
+      position,
+      Collision::RotatePoint(Vector2Scale(fixture.offset, scale), {0, 0},
+                             rotation, UsesPortableTrig()));
+  if (fixture.shape == ShapeType::Circle) {
+    float r = fixture.radius * scale;
+    return {center.x - r, center.y - r, r * 2, r * 2};
+  }
+
+  // Rotated rectangle: extents from the rotated unit axis
+  Vector2 axis =
+      Collision::RotatePoint({1, 0}, {0, 0}, rotation, UsesPortableTrig());
+  float halfW = fixture.size.x * scale / 2;
+  float halfH = fixture.size.y * scale / 2;
+  float extentX = halfW * fabsf(axis.x) + halfH * fabsf(axis.y);
+  float extentY = halfW * fabsf(axis.y) + halfH * fabsf(axis.x);
+  return {center.x - extentX, center.y - extentY, extentX * 2, extentY * 2};
+}
+
+void Object::MakeFixtureShape(int index, Object &out) const {
+  const Fixture &fixture = GetFixture(index);
+  out.portableTrig = UsesPortableTrig();
+  if (fixture.shape == ShapeType::Circle) {
+    out.SetCircle(fixture.radius);
+  } else {
+    out.SetRectangle(fixture.size.x, fixture.size.y);
+  }
+  out.SetPosition(Vector2Add(
+      position,
+      Collision::RotatePoint(Vector2Scale(fixture.offset, scale), {0, 0},
+                             rotation, UsesPortableTrig())));
+  out.SetRotation(rotation);
+  out.SetScale(scale);
+  out.SetTrigger(IsFixtureTrigger(index));
+  out.SetCollisionLayers(fixture.layers);
 }
 
 bool Object::IsCollidingWith(const Object *other) const {
@@ -1,33 +1,280 @@
 #include "../../fumbo.hpp"
 #include "raymath.h"
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <type_traits>
 
 namespace Fumbo {
 namespace Graphic2D {
 
+namespace {
+
+// Profiling clock; reads are skipped entirely while profiling is off
+using ProfileClock = std::chrono::steady_clock;
+
+ProfileClock::time_point ProfileNow(bool enabled) {
+  return enabled ? ProfileClock::now() : ProfileClock::time_point();
+}
+
+float ProfileMs(bool enabled, ProfileClock::time_point start) {
+  if (!enabled)
+    return 0.0f;
+  return std::chrono::duration<float, std::milli>(ProfileClock::now() - start)
+      .count();
+}
+
+// Pixels added around every broadphase AABB
+constexpr float BROADPHASE_MARGIN = 2.0f;
+
+// Farthest a contact point may move in one step and keep its warm start
+constexpr float WARM_START_DISTANCE = 2.0f;
+
+// Joint sweeps per solver iteration. Joints are cheap next to contacts,
+// and one sweep only carries an impulse one link down a long chain
+constexpr int JOINT_VELOCITY_SWEEPS = 4;
+constexpr int JOINT_POSITION_SWEEPS = 2;
+
+// Same one-way layer test the narrowphase runs on every fixture pair (`a`
+// is the lower id), so rejected pairs could never have produced a contact
+bool LayersCanMeet(const Object *a, const Object *b) {
+  for (int i = 0; i < a->GetFixtureCount(); i++) {
+    const CollisionLayers &layersA =
+        i == 0 ? a->GetCollisionLayers() : a->GetFixture(i).layers;
+    for (int j = 0; j < b->GetFixtureCount(); j++) {
+      const CollisionLayers &layersB =
+          j == 0 ? b->GetCollisionLayers() : b->GetFixture(j).layers;
+      if (layersA.CanCollideWith(layersB))
+        return true;
+    }
+  }
+  return false;
+}
+
+// 2D cross products (scalar result, and angular velocity x vector)
+float Cross(Vector2 a, Vector2 b) { return a.x * b.y - a.y * b.x; }
+Vector2 Cross(float w, Vector2 r) { return {-w * r.y, w * r.x}; }
+
+// Velocity of the body's material at offset `r` from its position
+Vector2 PointVelocity(const Object *object, Vector2 r) {
+  return Vector2Add(object->GetVelocity(),
+                    Cross(object->GetAngularVelocity() * DEG2RAD, r));
+}
+
+// Effective mass denominator for an impulse along `direction` at arms rA/rB
+float EffectiveMass(float invMassSum, float invInertiaA, float invInertiaB,
+                    Vector2 rA, Vector2 rB, Vector2 direction) {
+  float armA = Cross(rA, direction);
+  float armB = Cross(rB, direction);
+  return invMassSum + armA * armA * invInertiaA + armB * armB * invInertiaB;
+}
+
+// Both normal impulses of a two-point manifold at once (the 2x2 mixed
+// linear complementarity problem, solved by trying each case in turn).
+// `totals` holds the accumulated impulses and receives the new ones;
+// `velocities` are the current normal velocities at the points and
+// `targets` the normal velocities to reach. False when the points are so
+// close the system is ill-conditioned; solve them one by one instead.
+bool SolveNormalBlock(float invMassSum, float invInertiaA, float invInertiaB,
+                      const Vector2 (&arms)[2][2], Vector2 normal,
+                      const float (&velocities)[2], const float (&targets)[2],
+                      float (&totals)[2]) {
+  float rnA0 = Cross(arms[0][0], normal), rnB0 = Cross(arms[0][1], normal);
+  float rnA1 = Cross(arms[1][0], normal), rnB1 = Cross(arms[1][1], normal);
+  float k11 =
+      invMassSum + invInertiaA * rnA0 * rnA0 + invInertiaB * rnB0 * rnB0;
+  float k22 =
+      invMassSum + invInertiaA * rnA1 * rnA1 + invInertiaB * rnB1 * rnB1;
+  float k12 =
+      invMassSum + invInertiaA * rnA0 * rnA1 + invInertiaB * rnB0 * rnB1;
+  float determinant = k11 * k22 - k12 * k12;
+  if (k11 * k11 >= 1000.0f * determinant)
+    return false;
+
+  // Velocities with the accumulated impulses taken back out
+  float a0 = totals[0], a1 = totals[1];
+  float b0 = velocities[0] - targets[0] - (k11 * a0 + k12 * a1);
+  float b1 = velocities[1] - targets[1] - (k12 * a0 + k22 * a1);
+
+  // Both points pushing
+  float x0 = (k12 * b1 - k22 * b0) / determinant;
+  float x1 = (k12 * b0 - k11 * b1) / determinant;
+  if (x0 >= 0.0f && x1 >= 0.0f) {
+    totals[0] = x0;
+    totals[1] = x1;
+    return true;
+  }
+  // Only the first point pushing, the second separating
+  x0 = -b0 / k11;
+  if (x0 >= 0.0f && k12 * x0 + b1 >= 0.0f) {
+    totals[0] = x0;
+    totals[1] = 0.0f;
+    return true;
+  }
+  // Only the second
+  x1 = -b1 / k22;
+  if (x1 >= 0.0f && k12 * x1 + b0 >= 0.0f) {
+    totals[0] = 0.0f;
+    totals[1] = x1;
+    return true;
+  }
+  // Neither
+  if (b0 >= 0.0f && b1 >= 0.0f) {
+    totals[0] = 0.0f;
+    totals[1] = 0.0f;
+  }
+  return true;
+}
+
+} // namespace
+
 Physics::Physics()
     : gravity({0, 980.0f}), // Default gravity (pixels/s^2)
       fixedTimeStep(1.0f / 60.0f), accumulator(0.0f), iterations(4),
       debugDraw(false) {}
 
+Physics::~Physics() {
+  // Caller-owned objects and joints outlive the world; don't leave them
+  // pointing at it
+  Clear();
+}
+
 // Object Management
 
 void Physics::AddObject(Object *object) {
-  if (object &&
-      std::find(objects.begin(), objects.end(), object) == objects.end()) {
-    objects.push_back(object);
+  // Membership is tracked on the object, so this check is O(1)
+  if (!object || object->world == this)
+    return;
+  if (object->IsPooled() && GetHandle(object).IsNull())
+    return; // Pooled by another world
+
+  // An object lives in one world at a time
+  if (object->world) {
+    object->world->RemoveObject(object);
   }
+
+  object->world = this;
+  object->id = nextBodyId++;
+  object->worldSlot = (uint32_t)objects.size();
+  object->ResetInterpolation();
+  objects.push_back(object);
 }
 
 void Physics::RemoveObject(Object *object) {
-  auto it = std::find(objects.begin(), objects.end(), object);
-  if (it != objects.end()) {
-    objects.erase(it);
+  if (!object || object->world != this)
+    return;
+
+  // Swap-remove: move the last object into the freed slot
+  uint32_t slot = object->worldSlot;
+  Object *last = objects.back();
+  objects[slot] = last;
+  last->worldSlot = slot;
+  objects.pop_back();
+
+  object->world = nullptr;
+  object->worldSlot = Object::INVALID_SLOT;
+
+  // Joints can't outlive their bodies in the world. Joint::bodyA/bodyB are
+  // plain fields the caller may reassign, so scan rather than trust a
+  // per-body list.
+  for (size_t i = joints.size(); i > 0; i--) {
+    Joint *joint = joints[i - 1];
+    if (joint->bodyA == object || joint->bodyB == object) {
+      RemoveJoint(joint);
+    }
   }
 }
 
-void Physics::Clear() { objects.clear(); }
+void Physics::Clear() {
+  for (auto *object : objects) {
+    object->world = nullptr;
+    object->worldSlot = Object::INVALID_SLOT;
+  }
+  objects.clear();
+  nextBodyId = 1; // Fresh world: ids restart so replays line up
+
+  for (auto *joint : joints) {
+    joint->world = nullptr;
+  }
+  joints.clear();
+
+  // Release every live pooled body; outstanding handles become stale
+  poolFreeSlots.clear();
+  for (uint32_t slot = 0; slot < poolGenerations.size(); slot++) {
+    if (poolGenerations[slot] & 1u) {
+      poolGenerations[slot]++;
+    }
+    poolFreeSlots.push_back(slot);
+  }
+}
+
+// Body Pool
+
+BodyHandle Physics::CreateBody(const ObjectConfig &config) {
+  if (poolFreeSlots.empty()) {
+    // Grow by one block; existing objects never move
+    uint32_t first = (uint32_t)poolGenerations.size();
+    poolBlocks.emplace_back(new Object[POOL_BLOCK_SIZE]);
+    poolGenerations.resize(first + POOL_BLOCK_SIZE, 0);
+    for (uint32_t i = POOL_BLOCK_SIZE; i > 0; i--) {
+      poolFreeSlots.push_back(first + i - 1); // Lowest slot is used first
+    }
+  }
+
+  uint32_t slot = poolFreeSlots.back();
+  poolFreeSlots.pop_back();
+  poolGenerations[slot]++; // Even (free) -> odd (live)
+
+  Object *object = GetPoolObject(slot);
+  *object = Object();
+  object->poolSlot = slot;
+  ConfigureObject(object, config);
+  AddObject(object);
+
+  return {slot, poolGenerations[slot]};
+}
+
+void Physics::DestroyBody(BodyHandle handle) {
+  Object *object = GetBody(handle);
+  if (!object)
+    return;
+
+  RemoveObject(object);
+  poolGenerations[handle.index]++; // Odd (live) -> even (free)
+  poolFreeSlots.push_back(handle.index);
+}
+
+void Physics::DestroyBody(Object *object) {
+  if (!object)
+    return;
+
+  if (object->IsPooled()) {
+    DestroyBody(GetHandle(object));
+  } else {
+    RemoveObject(object);
+  }
+}
+
+Object *Physics::GetBody(BodyHandle handle) const {
+  if (handle.index >= poolGenerations.size() ||
+      poolGenerations[handle.index] != handle.generation ||
+      !(handle.generation & 1u)) {
+    return nullptr;
+  }
+  return GetPoolObject(handle.index);
+}
+
+BodyHandle Physics::GetHandle(const Object *object) const {
+  if (!object || !object->IsPooled() ||
+      object->poolSlot >= poolGenerations.size() ||
+      GetPoolObject(object->poolSlot) != object) {
+    return {};
+  }
+  uint32_t generation = poolGenerations[object->poolSlot];
+  if (!(generation & 1u))
+    return {};
+  return {object->poolSlot, generation};
+}
 
 // Physics Simulation
 
@@ -35,25 +282,126 @@ void Physics::Update(float deltaTime) {
   // Fixed timestep accumulator
   accumulator += deltaTime;
 
-  while (accumulator >= fixedTimeStep) {
-    Step(fixedTimeStep);
+  lastStepCount = 0;
+  lastSubstepCount = 0;
+  while (accumulator >= fixedTimeStep && lastStepCount < maxStepsPerFrame) {
+    // Remember where every body started this step for render interpolation
+    for (auto *object : objects) {
+      object->previousPosition = object->position;
+      object->previousRotation = object->rotation;
+    }
+
+    int substeps = ComputeSubsteps(fixedTimeStep);
+    for (int i = 0; i < substeps; i++) {
+      Step(fixedTimeStep / substeps);
+    }
+
     accumulator -= fixedTimeStep;
+    lastStepCount++;
+    lastSubstepCount = std::max(lastSubstepCount, substeps);
+  }
+
+  // Over budget: drop whole steps but keep the phase, so the next frame
+  // starts fresh instead of trying to catch up
+  float dropped = 0.0f;
+  if (accumulator >= fixedTimeStep) {
+    float kept = fmodf(accumulator, fixedTimeStep);
+    dropped = accumulator - kept;
+    accumulator = kept;
   }
+  timeDilation =
+      deltaTime > 0.0f ? fmaxf(1.0f - dropped / deltaTime, 0.0f) : 1.0f;
+
+  // The remainder carries into the next frame and drives
+  // GetInterpolationAlpha() for rendering in between steps
+}
+
+int Physics::ComputeSubsteps(float deltaTime) const {
+  if (!adaptiveSubsteps)
+    return 1;
+
+  // Largest distance any dynamic body covers per step, relative to its
+  // smallest extent
+  float worst = 0.0f;
+  for (const auto *object : objects) {
+    if (object->GetBodyType() != BodyType::Dynamic ||
+        !object->IsCollidable() || object->IsTrigger())
+      continue;
+
+    Rectangle box = object->GetShapeAABB();
+    float size = fminf(box.width, box.height);
+    if (size <= 0.0f)
+      continue;
+    float travel = Vector2Length(object->GetVelocity()) * deltaTime;
+    worst = fmaxf(worst, travel / (0.5f * size));
+  }
+
+  int substeps = (int)ceilf(worst);
+  return std::min(std::max(substeps, 1), maxSubsteps);
 }
 
 void Physics::Step(float deltaTime) {
+  stepStats = PhysicsStepStats();
+  auto stepStart = ProfileNow(profiling);
+
   // Apply gravity
   ApplyGravity(deltaTime);
 
-  // Update all objects
+  // Update all objects. Contacts are found where the bodies are now and
+  // solved together with the joints before positions move, so bodies
+  // never drift apart (or into each other) along their unconstrained path.
+  // Joint order alternates so chains converge from both ends.
   for (auto *object : objects) {
-    object->Update(deltaTime);
+    object->IntegrateVelocity(deltaTime);
   }
+  stepStats.integrateTime += ProfileMs(profiling, stepStart);
+
+  BuildJointFilter();
+  auto phaseStart = ProfileNow(profiling);
+  FindCollisionPairs(deltaTime);
+  stepStats.broadphaseTime += ProfileMs(profiling, phaseStart);
+  stepStats.candidatePairs = (int)pairs.size();
+  TestPairs();
+
+  phaseStart = ProfileNow(profiling);
+  PrepareContacts();
+  WarmStartJoints(lastSubstepTime > 0.0f ? deltaTime / lastSubstepTime
+                                         : 1.0f);
+  lastSubstepTime = deltaTime;
+  for (int i = 0; i < iterations; i++) {
+    for (int sweep = 0; sweep < JOINT_VELOCITY_SWEEPS; sweep++) {
+      SolveJointVelocities((i * JOINT_VELOCITY_SWEEPS + sweep) % 2 == 1);
+    }
+    SolveContactVelocities();
+    stepStats.solverIterations++;
+  }
+  stepStats.solveTime += ProfileMs(profiling, phaseStart);
+
+  phaseStart = ProfileNow(profiling);
+  for (auto *object : objects) {
+    object->IntegratePosition(deltaTime);
+  }
+  stepStats.integrateTime += ProfileMs(profiling, phaseStart);
 
-  // Resolve collisions (multiple iterations for stability)
+  // Then overlap and joint drift left after moving are corrected on
+  // positions alone, re-testing the same pairs every iteration
   for (int i = 0; i < iterations; i++) {
-    ResolveCollisions();
+    TestPairs();
+    phaseStart = ProfileNow(profiling);
+    SolveContactPositions();
+    for (int sweep = 0; sweep < JOINT_POSITION_SWEEPS; sweep++) {
+      SolveJointPositions((i * JOINT_POSITION_SWEEPS + sweep) % 2 == 1);
+    }
+    stepStats.solveTime += ProfileMs(profiling, phaseStart);
+  }
+
+  if (profiling) {
+    stepStats.totalTime = ProfileMs(profiling, stepStart);
+    RecordProfile();
   }
+  // Reset even when not profiling, so turning profiling on later doesn't
+  // report every raycast made since the world was created
+  pendingRaycasts = 0;
 }
 
 void Physics::ApplyGravity(float deltaTime) {
@@ -66,133 +414,580 @@ void Physics::ApplyGravity(float deltaTime) {
   }
 }
 
-void Physics::ResolveCollisions() {
-  for (size_t i = 0; i < objects.size(); i++) {
-    for (size_t j = i + 1; j < objects.size(); j++) {
-      Object *objectA = objects[i];
-      Object *objectB = objects[j];
+void Physics::FindCollisionPairs(float deltaTime) {
+  // Sort-and-sweep broadphase: compute every AABB once, sort by min x and
+  // only test bodies whose x ranges overlap
+  proxies.clear();
+  for (auto *object : objects) {
+    if (!object->IsCollidable())
+      continue;
+    // Fattened so bodies pushed into contact by the solver (or resting
+    // exactly edge to edge) already have their pair, and stretched over
+    // this step's motion so the position pass after moving has it too
+    bool dynamic = object->GetBodyType() == BodyType::Dynamic;
+    Rectangle aabb = object->GetAABB();
+    Vector2 motion = dynamic ? Vector2Scale(object->GetVelocity(), deltaTime)
+                             : Vector2{0, 0};
+    aabb = {aabb.x - BROADPHASE_MARGIN + fminf(motion.x, 0.0f),
+            aabb.y - BROADPHASE_MARGIN + fminf(motion.y, 0.0f),
+            aabb.width + 2 * BROADPHASE_MARGIN + fabsf(motion.x),
+            aabb.height + 2 * BROADPHASE_MARGIN + fabsf(motion.y)};
+    proxies.push_back({aabb, object, object->GetId(), dynamic});
+  }
+
+  std::sort(proxies.begin(), proxies.end(),
+            [](const BroadphaseProxy &proxyA, const BroadphaseProxy &proxyB) {
+              if (proxyA.aabb.x != proxyB.aabb.x)
+                return proxyA.aabb.x < proxyB.aabb.x;
+              return proxyA.id < proxyB.id;
+            });
+
+  // Keep last pass's pairs around so their SAT axis hints carry over
+  std::swap(pairs, previousPairs);
+  pairs.clear();
+  for (size_t i = 0; i < proxies.size(); i++) {
+    const BroadphaseProxy &proxyA = proxies[i];
+    float maxX = proxyA.aabb.x + proxyA.aabb.width;
+
+    for (size_t j = i + 1; j < proxies.size(); j++) {
+      const BroadphaseProxy &proxyB = proxies[j];
+      if (proxyB.aabb.x > maxX)
+        break; // Sorted: nothing further along can overlap on x
 
-      // Skip if either object is non-collidable
-      if (!objectA->IsCollidable() || !objectB->IsCollidable())
+      // Skip if neither body can be moved by the solver
+      if (!proxyA.dynamic && !proxyB.dynamic)
         continue;
 
-      // Skip if both are static
-      if (objectA->GetBodyType() == BodyType::Static &&
-          objectB->GetBodyType() == BodyType::Static) {
+      if (!CheckCollisionRecs(proxyA.aabb, proxyB.aabb))
         continue;
-      }
 
-      // Broadphase: Quick AABB overlap check before expensive collision
-      // detection
-      Rectangle aabbA = objectA->GetAABB();
-      Rectangle aabbB = objectB->GetAABB();
+      // Keep the lower id first so pair orientation doesn't depend on
+      // positions
+      Object *first = proxyA.object;
+      Object *second = proxyB.object;
+      if (second->GetId() < first->GetId())
+        std::swap(first, second);
+
+      if (!LayersCanMeet(first, second))
+        continue;
 
-      if (!CheckCollisionRecs(aabbA, aabbB)) {
-        continue; // No AABB overlap, skip expensive narrow-phase check
+      // Jointed bodies don't collide unless the joint allows it
+      if (!jointFilter.empty() &&
+          std::binary_search(jointFilter.begin(), jointFilter.end(),
+                             ((uint64_t)first->GetId() << 32) |
+                                 second->GetId())) {
+        continue;
       }
+      CollisionPair pair;
+      pair.idA = first->GetId();
+      pair.idB = second->GetId();
+      pair.objectA = first;
+      pair.objectB = second;
+      pairs.push_back(pair);
+    }
+  }
 
-      // Check collision
-      CollisionContact contact = Collision::CheckCollision(objectA, objectB);
+  // Process pairs in body-id order: the solver sees the same sequence on
+  // every machine regardless of float ties in the sweep (lockstep), and the
+  // previous pass's list can be merged in one walk
+  auto pairLess = [](const CollisionPair &pairA, const CollisionPair &pairB) {
+    if (pairA.idA != pairB.idA)
+      return pairA.idA < pairB.idA;
+    return pairA.idB < pairB.idB;
+  };
+  std::sort(pairs.begin(), pairs.end(), pairLess);
+
+  size_t previous = 0;
+  for (auto &pair : pairs) {
+    while (previous < previousPairs.size() &&
+           pairLess(previousPairs[previous], pair)) {
+      previous++;
+    }
+    if (previous < previousPairs.size() &&
+        previousPairs[previous].idA == pair.idA &&
+        previousPairs[previous].idB == pair.idB) {
+      static_cast<PairState &>(pair) = previousPairs[previous];
+    }
+  }
+}
 
-      if (contact.hasCollision) {
-        // If either is a trigger, don't resolve physics (just notify)
-        if (objectA->IsTrigger() || objectB->IsTrigger()) {
-          // TODO: Add trigger callback system
-          continue;
-        }
+bool Physics::IsSolidContact(const CollisionPair &pair,
+                             const CollisionContact &contact) const {
+  // If either fixture is a trigger, don't resolve physics (just notify)
+  // TODO: Add trigger callback system
+  return contact.hasCollision &&
+         !pair.objectA->IsFixtureTrigger(contact.fixtureA) &&
+         !pair.objectB->IsFixtureTrigger(contact.fixtureB);
+}
 
-        // Resolve collision
-        ResolveCollision(objectA, objectB, contact);
+void Physics::PrepareContacts() {
+  // Bounce targets come from the velocities before any impulse of this
+  // step. Last step's totals are kept point by point: each point takes
+  // the totals of the nearest old point on the same face, so a manifold
+  // gaining or losing a point doesn't drop the load the other one carries.
+  for (size_t k = 0; k < pairs.size(); k++) {
+    CollisionPair &pair = pairs[k];
+    const CollisionContact &contact = contacts[k];
+    int pointCount = IsSolidContact(pair, contact) ? contact.pointCount : 0;
+    float normalTotals[2] = {0.0f, 0.0f};
+    float tangentTotals[2] = {0.0f, 0.0f};
+    bool sameFace = Vector2DotProduct(pair.normal, contact.normal) >= 0.95f;
+    bool taken[2] = {false, false};
+    for (int i = 0; sameFace && i < pointCount; i++) {
+      int nearest = -1;
+      float best = WARM_START_DISTANCE * WARM_START_DISTANCE;
+      for (int j = 0; j < pair.pointCount; j++) {
+        float distance = Vector2DistanceSqr(pair.points[j], contact.points[i]);
+        if (!taken[j] && distance < best) {
+          best = distance;
+          nearest = j;
+        }
+      }
+      if (nearest >= 0) {
+        taken[nearest] = true;
+        normalTotals[i] = pair.normalImpulses[nearest];
+        tangentTotals[i] = pair.tangentImpulses[nearest];
       }
     }
+    for (int i = 0; i < 2; i++) {
+      pair.normalImpulses[i] = normalTotals[i];
+      pair.tangentImpulses[i] = tangentTotals[i];
+    }
+    pair.normal = contact.normal;
+    pair.pointCount = pointCount;
+
+    float restitution = fminf(pair.objectA->GetRestitution(),
+                              pair.objectB->GetRestitution());
+    for (int i = 0; i < pointCount; i++) {
+      pair.points[i] = contact.points[i];
+      Vector2 rA = Vector2Subtract(contact.points[i],
+                                   pair.objectA->GetPosition());
+      Vector2 rB = Vector2Subtract(contact.points[i],
+                                   pair.objectB->GetPosition());
+      float approach = Vector2DotProduct(
+          Vector2Subtract(PointVelocity(pair.objectB, rB),
+                          PointVelocity(pair.objectA, rA)),
+          contact.normal);
+      pair.bounceSpeeds[i] = approach < 0.0f ? -restitution * approach : 0.0f;
+    }
+  }
+
+  // Every pair re-applies its totals before any pair is solved, so a stack
+  // starts the step already holding up its load. Applying them pair by
+  // pair instead would let the bottom contact see the whole load before
+  // the contacts above push back.
+  for (const auto &pair : pairs) {
+    Vector2 tangent = {-pair.normal.y, pair.normal.x};
+    for (int i = 0; i < pair.pointCount; i++) {
+      Vector2 impulse =
+          Vector2Add(Vector2Scale(pair.normal, pair.normalImpulses[i]),
+                     Vector2Scale(tangent, pair.tangentImpulses[i]));
+      pair.objectA->ApplyImpulseAtPoint(Vector2Scale(impulse, -1.0f),
+                                        pair.points[i]);
+      pair.objectB->ApplyImpulseAtPoint(impulse, pair.points[i]);
+    }
   }
 }
 
-void Physics::ResolveCollision(Object *objectA, Object *objectB,
-                               const CollisionContact &contact) {
-  // Calculate relative velocity
-  Vector2 relativeVelocity =
-      Vector2Subtract(objectB->GetVelocity(), objectA->GetVelocity());
-  float velAlongNormal = Vector2DotProduct(relativeVelocity, contact.normal);
+void Physics::TestPairs() {
+  // The broadphase already dropped pairs whose layers can't meet, so every
+  // pair left reaches at least one shape test
+  stepStats.narrowphaseTests += (int)pairs.size();
+
+  auto phaseStart = ProfileNow(profiling);
+  contacts.resize(pairs.size());
+  for (size_t k = 0; k < pairs.size(); k++) {
+    CollisionPair &pair = pairs[k];
+    contacts[k] =
+        Collision::CheckCollision(pair.objectA, pair.objectB, &pair.axisHint);
+    if (contacts[k].hasCollision) {
+      stepStats.contacts++;
+    }
+  }
+  stepStats.narrowphaseTime += ProfileMs(profiling, phaseStart);
+}
 
-  // Don't resolve if objects are separating
-  if (velAlongNormal > 0)
-    return;
+void Physics::SolveContactVelocities() {
+  for (size_t k = 0; k < pairs.size(); k++) {
+    if (IsSolidContact(pairs[k], contacts[k])) {
+      SolveContactVelocity(pairs[k], contacts[k]);
+    }
+  }
+}
+
+void Physics::SolveContactPositions() {
+  for (size_t k = 0; k < pairs.size(); k++) {
+    if (IsSolidContact(pairs[k], contacts[k])) {
+      SolveContactPosition(pairs[k], contacts[k]);
+    }
+  }
+}
 
-  // Calculate restitution (bounciness)
-  float restitution =
-      fminf(objectA->GetRestitution(), objectB->GetRestitution());
+// Profiling
 
-  // Calculate impulse scalar
-  float impulseScalar = -(1.0f + restitution) * velAlongNormal;
+void Physics::RecordProfile() {
+  stepStats.bodies = (int)objects.size();
+  for (const auto *object : objects) {
+    if (object->GetBodyType() == BodyType::Dynamic &&
+        (object->velocity.x != 0.0f || object->velocity.y != 0.0f ||
+         object->angularVelocity != 0.0f)) {
+      stepStats.awakeBodies++;
+    }
+  }
+  stepStats.raycasts = pendingRaycasts;
 
-  bool aIsStatic = (objectA->GetBodyType() == BodyType::Static);
-  bool bIsStatic = (objectB->GetBodyType() == BodyType::Static);
+  profileHistory[profileHead] = stepStats;
+  profileHead = (profileHead + 1) % PROFILE_HISTORY;
+  profileCount = std::min(profileCount + 1, PROFILE_HISTORY);
+}
 
-  float invMassA = aIsStatic ? 0.0f : 1.0f / objectA->GetMass();
-  float invMassB = bIsStatic ? 0.0f : 1.0f / objectB->GetMass();
-  float invMassSum = invMassA + invMassB;
+const PhysicsStepStats &Physics::GetProfile(int age) const {
+  static const PhysicsStepStats empty;
+  if (age < 0 || age >= profileCount)
+    return empty;
+  return profileHistory[(profileHead - 1 - age + PROFILE_HISTORY) %
+                        PROFILE_HISTORY];
+}
 
-  if (invMassSum > 0.0001f) {
-    impulseScalar /= invMassSum;
+PhysicsStepStats Physics::GetAverageProfile() const {
+  PhysicsStepStats average;
+  if (profileCount == 0)
+    return average;
+
+  for (int i = 0; i < profileCount; i++) {
+    const PhysicsStepStats &step = profileHistory[i];
+    average.bodies += step.bodies;
+    average.awakeBodies += step.awakeBodies;
+    average.candidatePairs += step.candidatePairs;
+    average.narrowphaseTests += step.narrowphaseTests;
+    average.contacts += step.contacts;
+    average.raycasts += step.raycasts;
+    average.solverIterations += step.solverIterations;
+    average.broadphaseTime += step.broadphaseTime;
+    average.narrowphaseTime += step.narrowphaseTime;
+    average.solveTime += step.solveTime;
+    average.integrateTime += step.integrateTime;
+    average.totalTime += step.totalTime;
   }
 
-  // Apply impulse
-  Vector2 impulse = Vector2Scale(contact.normal, impulseScalar);
+  average.bodies /= profileCount;
+  average.awakeBodies /= profileCount;
+  average.candidatePairs /= profileCount;
+  average.narrowphaseTests /= profileCount;
+  average.contacts /= profileCount;
+  average.raycasts /= profileCount;
+  average.solverIterations /= profileCount;
+  float scale = 1.0f / profileCount;
+  average.broadphaseTime *= scale;
+  average.narrowphaseTime *= scale;
+  average.solveTime *= scale;
+  average.integrateTime *= scale;
+  average.totalTime *= scale;
+  return average;
+}
 
-  if (!aIsStatic) {
-    objectA->ApplyImpulse(Vector2Scale(impulse, -1.0f));
+void Physics::DrawProfileOverlay(Vector2 position) const {
+  PhysicsStepStats average = GetAverageProfile();
+  const float width = 260.0f;
+  const float graphHeight = 40.0f;
+  const float lineHeight = 14.0f;
+
+  Fumbo::Graphic2D::DrawRectangleV(position, {width, 150.0f + graphHeight},
+                                   Fade(BLACK, 0.7f));
+
+  // TextFormat reuses a few internal buffers, so each line is drawn as
+  // soon as it's formatted
+  float y = position.y + 6;
+  auto line = [&](const char *text, Color color) {
+    Fumbo::Graphic2D::DrawText(text, {position.x + 6, y}, {}, 10, color);
+    y += lineHeight;
+  };
+  line(TextFormat("PHYSICS (avg of %d steps)", profileCount), YELLOW);
+  line(TextFormat("bodies %d  awake %d", average.bodies, average.awakeBodies),
+       RAYWHITE);
+  line(TextFormat("pairs %d  tests %d  contacts %d", average.candidatePairs,
+                  average.narrowphaseTests, average.contacts),
+       RAYWHITE);
+  line(TextFormat("raycasts %d  iterations %d", average.raycasts,
+                  average.solverIterations),
+       RAYWHITE);
+  line(TextFormat("broadphase  %.3f ms", average.broadphaseTime), RAYWHITE);
+  line(TextFormat("narrowphase %.3f ms", average.narrowphaseTime), RAYWHITE);
+  line(TextFormat("solve       %.3f ms", average.solveTime), RAYWHITE);
+  line(TextFormat("integrate   %.3f ms", average.integrateTime), RAYWHITE);
+  line(TextFormat("step        %.3f ms", average.totalTime), RAYWHITE);
+
+  // Step time graph, oldest on the left; full height = one fixed step
+  Vector2 graph = {position.x + 6, position.y + 144};
+  float budget = fixedTimeStep * 1000.0f;
+  float barWidth = (width - 12) / PROFILE_HISTORY;
+  for (int age = 0; age < profileCount; age++) {
+    float time = GetProfile(age).totalTime;
+    float height = fminf(time / budget, 1.0f) * graphHeight;
+    Color color = time > budget * 0.5f ? ORANGE : LIME;
+    Fumbo::Graphic2D::DrawRectangleV(
+        {graph.x + (PROFILE_HISTORY - 1 - age) * barWidth,
+         graph.y + graphHeight - height},
+        {barWidth, height}, color);
   }
-  if (!bIsStatic) {
-    objectB->ApplyImpulse(impulse);
+}
+
+namespace {
+
+// Solver view of a contact's two bodies. Static and kinematic bodies have
+// infinite mass for the solver.
+struct ContactBodies {
+  Object *a, *b;
+  float invMassA, invMassB, invMassSum;
+  float invInertiaA, invInertiaB;
+  Vector2 arms[2][2]; // [point][A, B]
+};
+
+ContactBodies GetContactBodies(Object *a, Object *b,
+                               const CollisionContact &contact) {
+  ContactBodies bodies;
+  bodies.a = a;
+  bodies.b = b;
+  bodies.invMassA = bodies.a->GetBodyType() == BodyType::Dynamic
+                        ? 1.0f / bodies.a->GetMass()
+                        : 0.0f;
+  bodies.invMassB = bodies.b->GetBodyType() == BodyType::Dynamic
+                        ? 1.0f / bodies.b->GetMass()
+                        : 0.0f;
+  bodies.invMassSum = bodies.invMassA + bodies.invMassB;
+  bodies.invInertiaA = bodies.a->GetInverseInertia();
+  bodies.invInertiaB = bodies.b->GetInverseInertia();
+  for (int i = 0; i < contact.pointCount; i++) {
+    bodies.arms[i][0] =
+        Vector2Subtract(contact.points[i], bodies.a->GetPosition());
+    bodies.arms[i][1] =
+        Vector2Subtract(contact.points[i], bodies.b->GetPosition());
   }
+  return bodies;
+}
+
+float NormalVelocity(const ContactBodies &bodies, int point, Vector2 normal) {
+  return Vector2DotProduct(
+      Vector2Subtract(PointVelocity(bodies.b, bodies.arms[point][1]),
+                      PointVelocity(bodies.a, bodies.arms[point][0])),
+      normal);
+}
 
-  // Positional correction to prevent sinking
-  const float percent = 0.4f; // Penetration percentage to correct
-  const float slop = 0.01f;   // Penetration allowance
-  float correctionAmount =
-      fmaxf(contact.penetration - slop, 0.0f) / invMassSum * percent;
-  Vector2 correction = Vector2Scale(contact.normal, correctionAmount);
+// Position pass: overlap allowed to stay (keeps resting contacts touching
+// from step to step), share of the rest removed per iteration, and the
+// most one iteration may move a point
+constexpr float LINEAR_SLOP = 0.1f;
+constexpr float POSITION_CORRECTION = 0.2f;
+constexpr float MAX_CORRECTION = 4.0f;
 
-  if (!aIsStatic) {
-    Vector2 newPos = Vector2Subtract(objectA->GetPosition(),
-                                     Vector2Scale(correction, invMassA));
-    objectA->SetPosition(newPos);
+} // namespace
+
+void Physics::SolveContactVelocity(CollisionPair &pair,
+                                   const CollisionContact &contact) {
+  ContactBodies bodies =
+      GetContactBodies(pair.objectA, pair.objectB, contact);
+  if (bodies.invMassSum <= 0.0001f)
+    return;
+
+  // Impulses act at each manifold point, so off-center hits spin bodies
+  int pointCount = contact.pointCount;
+  Vector2 normal = contact.normal;
+  Vector2 tangent = {-normal.y, normal.x};
+  auto applyAt = [&](int i, Vector2 impulse) {
+    bodies.a->ApplyImpulseAtPoint(Vector2Scale(impulse, -1.0f),
+                                  contact.points[i]);
+    bodies.b->ApplyImpulseAtPoint(impulse, contact.points[i]);
+  };
+
+  // Friction first, bounded by each point's normal total, so the normal
+  // impulses solved last have the final say
+  float friction = sqrtf(bodies.a->GetFriction() * bodies.b->GetFriction());
+  for (int i = 0; i < pointCount; i++) {
+    Vector2 relativeVelocity =
+        Vector2Subtract(PointVelocity(bodies.b, bodies.arms[i][1]),
+                        PointVelocity(bodies.a, bodies.arms[i][0]));
+    float impulse =
+        -Vector2DotProduct(relativeVelocity, tangent) /
+        EffectiveMass(bodies.invMassSum, bodies.invInertiaA,
+                      bodies.invInertiaB, bodies.arms[i][0],
+                      bodies.arms[i][1], tangent);
+    float limit = friction * pair.normalImpulses[i];
+    float total =
+        fmaxf(-limit, fminf(pair.tangentImpulses[i] + impulse, limit));
+    applyAt(i, Vector2Scale(tangent, total - pair.tangentImpulses[i]));
+    pair.tangentImpulses[i] = total;
+  }
+
+  // Normal impulses, totals kept non-negative so a later iteration can
+  // take back an overshoot without ever pulling the bodies together. A
+  // two-point manifold is solved as one 2x2 block so both points share the
+  // load exactly: solving them one after another lets the first point take
+  // it all, and the leftover imbalance spins resting boxes until stacks
+  // tip over.
+  float totals[2] = {pair.normalImpulses[0], pair.normalImpulses[1]};
+  float velocities[2];
+  for (int i = 0; i < pointCount; i++) {
+    velocities[i] = NormalVelocity(bodies, i, normal);
+  }
+  if (pointCount == 2 &&
+      SolveNormalBlock(bodies.invMassSum, bodies.invInertiaA,
+                       bodies.invInertiaB, bodies.arms, normal, velocities,
+                       pair.bounceSpeeds, totals)) {
+    for (int i = 0; i < 2; i++) {
+      applyAt(i, Vector2Scale(normal, totals[i] - pair.normalImpulses[i]));
+      pair.normalImpulses[i] = totals[i];
+    }
+    return;
+  }
+  for (int i = 0; i < pointCount; i++) {
+    float impulse = (pair.bounceSpeeds[i] - NormalVelocity(bodies, i, normal)) /
+                    EffectiveMass(bodies.invMassSum, bodies.invInertiaA,
+                                  bodies.invInertiaB, bodies.arms[i][0],
+                                  bodies.arms[i][1], normal);
+    float total = fmaxf(pair.normalImpulses[i] + impulse, 0.0f);
+    applyAt(i, Vector2Scale(normal, total - pair.normalImpulses[i]));
+    pair.normalImpulses[i] = total;
   }
-  if (!bIsStatic) {
-    Vector2 newPos =
-        Vector2Add(objectB->GetPosition(), Vector2Scale(correction, invMassB));
-    objectB->SetPosition(newPos);
+}
+
+void Physics::SolveContactPosition(const CollisionPair &pair,
+                                   const CollisionContact &contact) {
+  ContactBodies bodies =
+      GetContactBodies(pair.objectA, pair.objectB, contact);
+  if (bodies.invMassSum <= 0.0001f)
+    return;
+
+  // Each point's overlap is pushed out where it is, turning the bodies as
+  // well as moving them, so a box sunk at one corner levels out instead of
+  // being lifted whole and left tilted
+  int pointCount = contact.pointCount;
+  Vector2 normal = contact.normal;
+  float errors[2]; // Negative: overlap to remove this iteration
+  for (int i = 0; i < pointCount; i++) {
+    errors[i] = fmaxf(
+        fminf(-POSITION_CORRECTION * (contact.depths[i] - LINEAR_SLOP), 0.0f),
+        -MAX_CORRECTION);
+  }
+  float pushes[2] = {0.0f, 0.0f};
+  const float noTarget[2] = {0.0f, 0.0f};
+  if (pointCount != 2 ||
+      !SolveNormalBlock(bodies.invMassSum, bodies.invInertiaA,
+                        bodies.invInertiaB, bodies.arms, normal, errors,
+                        noTarget, pushes)) {
+    for (int i = 0; i < pointCount; i++) {
+      pushes[i] = -errors[i] /
+                  EffectiveMass(bodies.invMassSum, bodies.invInertiaA,
+                                bodies.invInertiaB, bodies.arms[i][0],
+                                bodies.arms[i][1], normal);
+      if (pointCount == 2)
+        pushes[i] *= 0.5f; // Points too close to solve apart
+    }
+  }
+
+  for (int i = 0; i < pointCount; i++) {
+    Vector2 push = Vector2Scale(normal, pushes[i]);
+    if (bodies.invMassA > 0.0f) {
+      bodies.a->SetPosition(Vector2Subtract(
+          bodies.a->GetPosition(), Vector2Scale(push, bodies.invMassA)));
+      bodies.a->SetRotation(bodies.a->GetRotation() -
+                            Cross(bodies.arms[i][0], push) *
+                                bodies.invInertiaA * RAD2DEG);
+    }
+    if (bodies.invMassB > 0.0f) {
+      bodies.b->SetPosition(Vector2Add(bodies.b->GetPosition(),
+                                       Vector2Scale(push, bodies.invMassB)));
+      bodies.b->SetRotation(bodies.b->GetRotation() +
+                            Cross(bodies.arms[i][1], push) *
+                                bodies.invInertiaB * RAD2DEG);
+    }
   }
+}
+
+// Raycasting
 
-  // Apply friction
-  Vector2 tangent = Vector2Subtract(
-      relativeVelocity, Vector2Scale(contact.normal, velAlongNormal));
-  float tangentLength = Vector2Length(tangent);
+namespace {
 
-  if (tangentLength > 0.0001f) {
-    tangent = Vector2Scale(tangent, 1.0f / tangentLength);
+// Ray against one shape (fixtures are passed as stand-in shapes). Updates
+// `hit` when this shape is hit closer than hit.distance.
+void RaycastShape(const Object *shape, Vector2 origin, Vector2 direction,
+                  Vector2 rayEnd, RaycastHit &hit) {
+  ShapeType type = shape->GetShapeType();
 
-    float friction = sqrtf(objectA->GetFriction() * objectB->GetFriction());
-    float frictionImpulse = -Vector2DotProduct(relativeVelocity, tangent);
-    frictionImpulse /= invMassSum;
-    frictionImpulse *= friction;
+  if (type == ShapeType::Circle) {
+    // Ray-circle intersection
+    float radius = shape->GetRadius() * shape->GetScale();
+    Vector2 toCircle = Vector2Subtract(shape->GetPosition(), origin);
+    float projection = Vector2DotProduct(toCircle, direction);
 
-    Vector2 frictionVector = Vector2Scale(tangent, frictionImpulse);
+    if (projection < 0)
+      return; // Behind ray
 
-    if (!aIsStatic) {
-      objectA->ApplyImpulse(Vector2Scale(frictionVector, -1.0f));
+    Vector2 closest = Vector2Add(origin, Vector2Scale(direction, projection));
+    float distToCenter = Vector2Distance(closest, shape->GetPosition());
+
+    if (distToCenter <= radius) {
+      float offset = sqrtf(radius * radius - distToCenter * distToCenter);
+      float hitDist = projection - offset;
+
+      if (hitDist >= 0 && hitDist < hit.distance) {
+        hit.hit = true;
+        hit.distance = hitDist;
+        hit.point = Vector2Add(origin, Vector2Scale(direction, hitDist));
+        hit.normal = Vector2Normalize(
+            Vector2Subtract(hit.point, shape->GetPosition()));
+      }
     }
-    if (!bIsStatic) {
-      objectB->ApplyImpulse(Vector2Scale(frictionVector, 1.0f));
+  } else if (type == ShapeType::Rectangle || type == ShapeType::Polygon ||
+             type == ShapeType::Triangle) {
+    // Ray-polygon intersection
+    const auto &vertices = shape->GetVertices();
+    for (size_t i = 0; i < vertices.size(); i++) {
+      Vector2 point1 = vertices[i];
+      Vector2 point2 = vertices[(i + 1) % vertices.size()];
+
+      Vector2 intersection;
+      if (Collision::LineIntersection(origin, rayEnd, point1, point2,
+                                      &intersection)) {
+        float dist = Vector2Distance(origin, intersection);
+        if (dist < hit.distance) {
+          hit.hit = true;
+          hit.distance = dist;
+          hit.point = intersection;
+
+          // Calculate normal from edge
+          Vector2 edge = Vector2Subtract(point2, point1);
+          hit.normal = Vector2Normalize({-edge.y, edge.x});
+        }
+      }
     }
   }
 }
 
-// Raycasting
+// Ray against an object's shape and all of its fixtures
+void RaycastObject(Object *object, Vector2 origin, Vector2 direction,
+                   Vector2 rayEnd, Object &fixtureShape, RaycastHit &hit) {
+  for (int i = 0; i < object->GetFixtureCount(); i++) {
+    const Object *shape = object;
+    if (i > 0) {
+      object->MakeFixtureShape(i, fixtureShape);
+      shape = &fixtureShape;
+    }
+
+    bool wasHit = hit.hit;
+    float previousDistance = hit.distance;
+    RaycastShape(shape, origin, direction, rayEnd, hit);
+    if (hit.hit && (!wasHit || hit.distance < previousDistance)) {
+      hit.object = object;
+      hit.fixture = i;
+    }
+  }
+}
+
+} // namespace
 
 RaycastHit Physics::Raycast(Vector2 origin, Vector2 direction,
                             float maxDistance) {
+  pendingRaycasts++;
   RaycastHit result;
   result.hit = false;
   result.distance = maxDistance;
@@ -202,62 +997,10 @@ RaycastHit Physics::Raycast(Vector2 origin, Vector2 direction,
   Vector2 rayEnd =
       Vector2Add(origin, Vector2Scale(directionNormalized, maxDistance));
 
+  Object fixtureShape;
   for (auto *object : objects) {
-    // Simple raycast using line-shape intersection
-    ShapeType type = object->GetShapeType();
-
-    if (type == ShapeType::Circle) {
-      // Ray-circle intersection
-      Vector2 toCircle = Vector2Subtract(object->GetPosition(), origin);
-      float projection = Vector2DotProduct(toCircle, directionNormalized);
-
-      if (projection < 0)
-        continue; // Behind ray
-
-      Vector2 closest =
-          Vector2Add(origin, Vector2Scale(directionNormalized, projection));
-      float distToCenter = Vector2Distance(closest, object->GetPosition());
-
-      if (distToCenter <= object->GetRadius()) {
-        float offset = sqrtf(object->GetRadius() * object->GetRadius() -
-                             distToCenter * distToCenter);
-        float hitDist = projection - offset;
-
-        if (hitDist >= 0 && hitDist < result.distance) {
-          result.hit = true;
-          result.distance = hitDist;
-          result.object = object;
-          result.point =
-              Vector2Add(origin, Vector2Scale(directionNormalized, hitDist));
-          result.normal = Vector2Normalize(
-              Vector2Subtract(result.point, object->GetPosition()));
-        }
-      }
-    } else if (type == ShapeType::Rectangle || type == ShapeType::Polygon ||
-               type == ShapeType::Triangle) {
-      // Ray-polygon intersection
-      auto vertices = object->GetVertices();
-      for (size_t i = 0; i < vertices.size(); i++) {
-        Vector2 point1 = vertices[i];
-        Vector2 point2 = vertices[(i + 1) % vertices.size()];
-
-        Vector2 intersection;
-        if (Collision::LineIntersection(origin, rayEnd, point1, point2,
-                                        &intersection)) {
-          float dist = Vector2Distance(origin, intersection);
-          if (dist < result.distance) {
-            result.hit = true;
-            result.distance = dist;
-            result.object = object;
-            result.point = intersection;
-
-            // Calculate normal from edge
-            Vector2 edge = Vector2Subtract(point2, point1);
-            result.normal = Vector2Normalize({-edge.y, edge.x});
-          }
-        }
-      }
-    }
+    RaycastObject(object, origin, directionNormalized, rayEnd, fixtureShape,
+                  result);
   }
 
   return result;
@@ -265,92 +1008,403 @@ RaycastHit Physics::Raycast(Vector2 origin, Vector2 direction,
 
 std::vector<RaycastHit> Physics::RaycastAll(Vector2 origin, Vector2 direction,
                                             float maxDistance) {
+  pendingRaycasts++;
   std::vector<RaycastHit> hits;
 
   Vector2 directionNormalized = Vector2Normalize(direction);
   Vector2 rayEnd =
       Vector2Add(origin, Vector2Scale(directionNormalized, maxDistance));
 
+  Object fixtureShape;
   for (auto *object : objects) {
     RaycastHit tempResult;
     tempResult.hit = false;
     tempResult.distance = maxDistance;
+    tempResult.object = nullptr;
 
-    ShapeType type = object->GetShapeType();
-
-    if (type == ShapeType::Circle) {
-      Vector2 toCircle = Vector2Subtract(object->GetPosition(), origin);
-      float projection = Vector2DotProduct(toCircle, directionNormalized);
-
-      if (projection >= 0) {
-        Vector2 closest =
-            Vector2Add(origin, Vector2Scale(directionNormalized, projection));
-        float distToCenter = Vector2Distance(closest, object->GetPosition());
-
-        if (distToCenter <= object->GetRadius()) {
-          float offset = sqrtf(object->GetRadius() * object->GetRadius() -
-                               distToCenter * distToCenter);
-          float hitDist = projection - offset;
-
-          if (hitDist >= 0) {
-            tempResult.hit = true;
-            tempResult.distance = hitDist;
-            tempResult.object = object;
-            tempResult.point =
-                Vector2Add(origin, Vector2Scale(directionNormalized, hitDist));
-            tempResult.normal = Vector2Normalize(
-                Vector2Subtract(tempResult.point, object->GetPosition()));
-          }
-        }
-      }
-    } else if (type == ShapeType::Rectangle || type == ShapeType::Polygon ||
-               type == ShapeType::Triangle) {
-      auto vertices = object->GetVertices();
-      for (size_t i = 0; i < vertices.size(); i++) {
-        Vector2 point1 = vertices[i];
-        Vector2 point2 = vertices[(i + 1) % vertices.size()];
-
-        Vector2 intersection;
-        if (Collision::LineIntersection(origin, rayEnd, point1, point2,
-                                        &intersection)) {
-          float dist = Vector2Distance(origin, intersection);
-          if (!tempResult.hit || dist < tempResult.distance) {
-            tempResult.hit = true;
-            tempResult.distance = dist;
-            tempResult.object = object;
-            tempResult.point = intersection;
-
-            Vector2 edge = Vector2Subtract(point2, point1);
-            tempResult.normal = Vector2Normalize({-edge.y, edge.x});
-          }
-        }
-      }
-    }
+    RaycastObject(object, origin, directionNormalized, rayEnd, fixtureShape,
+                  tempResult);
 
     if (tempResult.hit) {
       hits.push_back(tempResult);
     }
   }
 
-  // Sort by distance
+  // Sort by distance, ties broken by body id so the order never depends on
+  // the sort implementation
   std::sort(hits.begin(), hits.end(),
             [](const RaycastHit &hitA, const RaycastHit &hitB) {
-              return hitA.distance < hitB.distance;
+              if (hitA.distance != hitB.distance)
+                return hitA.distance < hitB.distance;
+              return hitA.object->GetId() < hitB.object->GetId();
             });
 
   return hits;
 }
 
+// Broadphase Query
+
+void Physics::QueryAABB(Rectangle area, std::vector<Object *> &results) const {
+  for (auto *object : objects) {
+    if (!object->IsCollidable())
+      continue;
+    if (CheckCollisionRecs(area, object->GetAABB())) {
+      results.push_back(object);
+    }
+  }
+}
+
+// Character Movement
+
+MoveResult Physics::MoveAndSlide(Object *object, Vector2 motion,
+                                 Vector2 upDirection, float floorMaxAngle) {
+  MoveResult result = {};
+  if (!object)
+    return result;
+
+  Vector2 start = object->GetPosition();
+  Rectangle from = object->GetAABB();
+
+  // Broadphase: gather everything the swept shape could touch, once
+  const float margin = 1.0f;
+  float minX = fminf(from.x, from.x + motion.x) - margin;
+  float minY = fminf(from.y, from.y + motion.y) - margin;
+  float maxX = fmaxf(from.x, from.x + motion.x) + from.width + margin;
+  float maxY = fmaxf(from.y, from.y + motion.y) + from.height + margin;
+
+  moveCandidates.clear();
+  QueryAABB({minX, minY, maxX - minX, maxY - minY}, moveCandidates);
+
+  // Sub-step the sweep so thin geometry can't be skipped
+  float stepLength = fmaxf(fminf(from.width, from.height) * 0.5f, 1.0f);
+  int steps = (int)ceilf(Vector2Length(motion) / stepLength);
+  steps = std::max(1, std::min(steps, 64));
+
+  float floorCos;
+  if (deterministic) {
+    Collision::PortableSinCos(floorMaxAngle, nullptr, &floorCos);
+  } else {
+    floorCos = cosf(floorMaxAngle * DEG2RAD);
+  }
+  bool hasUp = (upDirection.x != 0.0f || upDirection.y != 0.0f);
+  Vector2 up = hasUp ? Vector2Normalize(upDirection) : Vector2{0, 0};
+
+  const int maxSlideIterations = 4;
+  Vector2 remaining = motion;
+
+  for (int step = 0; step < steps; step++) {
+    Vector2 stepMotion = Vector2Scale(remaining, 1.0f / (steps - step));
+    remaining = Vector2Subtract(remaining, stepMotion);
+    object->SetPosition(Vector2Add(object->GetPosition(), stepMotion));
+
+    for (int iteration = 0; iteration < maxSlideIterations; iteration++) {
+      bool resolved = false;
+
+      for (auto *other : moveCandidates) {
+        if (other == object || other->IsTrigger())
+          continue;
+
+        CollisionContact contact = Collision::CheckCollision(object, other);
+        if (!contact.hasCollision || contact.penetration <= 0.0f)
+          continue;
+        if (object->IsFixtureTrigger(contact.fixtureA) ||
+            other->IsFixtureTrigger(contact.fixtureB)) {
+          continue; // Sensors never block
+        }
+
+        // Surface normal pointing back at the mover
+        Vector2 normal = Vector2Scale(contact.normal, -1.0f);
+        float upDot = hasUp ? Vector2DotProduct(normal, up) : 0.0f;
+        bool isFloor = hasUp && upDot >= floorCos;
+        bool isCeiling = hasUp && upDot <= -floorCos;
+
+        // Kinematic bodies have infinite mass: shove dynamic bodies aside
+        // instead of being blocked by them (but still stand on them)
+        if (other->GetBodyType() == BodyType::Dynamic && !isFloor) {
+          other->SetPosition(Vector2Add(
+              other->GetPosition(),
+              Vector2Scale(contact.normal, contact.penetration)));
+          continue;
+        }
+
+        object->SetPosition(Vector2Add(
+            object->GetPosition(), Vector2Scale(normal, contact.penetration)));
+
+        // Slide: drop the part of the remaining motion that goes into the
+        // surface
+        float into = Vector2DotProduct(remaining, normal);
+        if (into < 0.0f) {
+          remaining = Vector2Subtract(remaining, Vector2Scale(normal, into));
+        }
+
+        if (isFloor) {
+          result.onFloor = true;
+          result.floorNormal = normal;
+          result.floorObject = other;
+        } else if (isCeiling) {
+          result.onCeiling = true;
+        } else {
+          result.onWall = true;
+          result.wallNormal = normal;
+        }
+
+        result.collisionCount++;
+        resolved = true;
+      }
+
+      if (!resolved)
+        break;
+    }
+  }
+
+  result.motion = Vector2Subtract(object->GetPosition(), start);
+  return result;
+}
+
+// Determinism
+
+void Physics::SetDeterministic(bool enabled) {
+  deterministic = enabled;
+}
+
+uint64_t Physics::ComputeStateHash() const {
+  // FNV-1a over the raw bits of each body's state, in world order
+  uint64_t hash = 14695981039346656037ULL;
+  auto mix = [&hash](const void *data, size_t size) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; i++) {
+      hash ^= bytes[i];
+      hash *= 1099511628211ULL;
+    }
+  };
+
+  for (const auto *object : objects) {
+    uint32_t id = object->GetId();
+    Vector2 position = object->GetPosition();
+    Vector2 velocity = object->GetVelocity();
+    float rotation = object->GetRotation();
+    float angularVelocity = object->GetAngularVelocity();
+
+    mix(&id, sizeof(id));
+    mix(&position, sizeof(position));
+    mix(&velocity, sizeof(velocity));
+    mix(&rotation, sizeof(rotation));
+    mix(&angularVelocity, sizeof(angularVelocity));
+  }
+
+  return hash;
+}
+
+// Snapshots
+
+static_assert(std::is_trivially_copyable<BodyState>::value,
+              "BodyState must stay plain data for snapshot copies");
+
+void Physics::SaveSnapshot(PhysicsSnapshot &snapshot) const {
+  // Capacity is kept between saves, so a reserved snapshot never allocates
+  snapshot.objects.assign(objects.begin(), objects.end());
+  snapshot.bodies.resize(objects.size());
+  snapshot.poolGenerations.assign(poolGenerations.begin(),
+                                  poolGenerations.end());
+  snapshot.poolFreeSlots.assign(poolFreeSlots.begin(), poolFreeSlots.end());
+  snapshot.pairs.assign(pairs.begin(), pairs.end());
+  snapshot.joints.assign(joints.begin(), joints.end());
+  snapshot.jointStates.resize(joints.size());
+  for (size_t i = 0; i < joints.size(); i++) {
+    snapshot.jointStates[i] = {joints[i]->impulse, joints[i]->angularImpulse};
+  }
+  snapshot.accumulator = accumulator;
+  snapshot.lastSubstepTime = lastSubstepTime;
+  snapshot.nextBodyId = nextBodyId;
+
+  BodyState *state = snapshot.bodies.data();
+  for (const auto *object : objects) {
+    state->position = object->position;
+    state->previousPosition = object->previousPosition;
+    state->velocity = object->velocity;
+    state->acceleration = object->acceleration;
+    state->rotation = object->rotation;
+    state->previousRotation = object->previousRotation;
+    state->angularVelocity = object->angularVelocity;
+    state->torque = object->torque;
+    state->id = object->id;
+    state++;
+  }
+}
+
+void Physics::RestoreSnapshot(const PhysicsSnapshot &snapshot) {
+  // Bodies added after the save leave the world...
+  for (auto *object : objects) {
+    object->world = nullptr;
+    object->worldSlot = Object::INVALID_SLOT;
+  }
+
+  for (auto *joint : joints) {
+    joint->world = nullptr;
+  }
+
+  accumulator = snapshot.accumulator;
+  lastSubstepTime = snapshot.lastSubstepTime;
+  nextBodyId = snapshot.nextBodyId;
+
+  // Bodies created since the save are freed and destroyed ones revived.
+  // Blocks added after the save stay allocated but free; they're handed
+  // out after the saved free slots, in the order a fresh block would be,
+  // so replays pick the same slots.
+  uint32_t savedSlots = (uint32_t)snapshot.poolGenerations.size();
+  poolFreeSlots.clear();
+  for (uint32_t slot = (uint32_t)poolGenerations.size(); slot > savedSlots;
+       slot--) {
+    if (poolGenerations[slot - 1] & 1u) {
+      poolGenerations[slot - 1]++; // Odd (live) -> even (free)
+    }
+    poolFreeSlots.push_back(slot - 1);
+  }
+  for (uint32_t slot = 0; slot < savedSlots; slot++) {
+    uint32_t saved = snapshot.poolGenerations[slot];
+    uint32_t &generation = poolGenerations[slot];
+    if (generation == saved || ((saved & 1u) && generation == saved + 1)) {
+      generation = saved; // Untouched, or destroyed and not reused since
+      continue;
+    }
+    // Reused since the save, which overwrote the saved body's shape and
+    // material. The slot is freed without going back, so neither the saved
+    // body's handles nor the new occupant's find it again.
+    generation += generation & 1u;
+    if (saved & 1u) {
+      poolFreeSlots.push_back(slot);
+    }
+  }
+  poolFreeSlots.insert(poolFreeSlots.end(), snapshot.poolFreeSlots.begin(),
+                       snapshot.poolFreeSlots.end());
+
+  // Contact warm starts too; the next step only matches them by id
+  pairs.resize(snapshot.pairs.size());
+  for (size_t i = 0; i < pairs.size(); i++) {
+    pairs[i] = CollisionPair();
+    static_cast<PairState &>(pairs[i]) = snapshot.pairs[i];
+  }
+
+  // ...and everything in the snapshot is back with its saved state, except
+  // pooled bodies whose slot was reused
+  objects.clear();
+  const BodyState *state = snapshot.bodies.data();
+  uint32_t slot = 0;
+  for (auto *object : snapshot.objects) {
+    if (object->IsPooled() && GetHandle(object).IsNull()) {
+      state++;
+      continue;
+    }
+    if (object->world && object->world != this) {
+      object->world->RemoveObject(object);
+    }
+    object->world = this;
+    object->worldSlot = slot++;
+    object->position = state->position;
+    object->previousPosition = state->previousPosition;
+    object->velocity = state->velocity;
+    object->acceleration = state->acceleration;
+    object->rotation = state->rotation;
+    object->previousRotation = state->previousRotation;
+    object->angularVelocity = state->angularVelocity;
+    object->torque = state->torque;
+    object->id = state->id;
+    objects.push_back(object);
+    state++;
+  }
+
+  // Joints go back in their saved order, as long as both bodies did too
+  joints.clear();
+  for (size_t i = 0; i < snapshot.joints.size(); i++) {
+    Joint *joint = snapshot.joints[i];
+    if (joint->world && joint->world != this) {
+      joint->world->RemoveJoint(joint);
+    }
+    if ((joint->bodyA && joint->bodyA->world != this) ||
+        (joint->bodyB && joint->bodyB->world != this)) {
+      continue;
+    }
+    joint->world = this;
+    joint->worldSlot = (uint32_t)joints.size();
+    joint->impulse = snapshot.jointStates[i].impulse;
+    joint->angularImpulse = snapshot.jointStates[i].angularImpulse;
+    joints.push_back(joint);
+  }
+}
+
 // Debug Rendering
 
+void Physics::QueryVisible(Rectangle area,
+                           std::vector<Object *> &results) const {
+  for (auto *object : objects) {
+    if (CheckCollisionRecs(area, object->GetInterpolatedAABB())) {
+      results.push_back(object);
+    }
+  }
+}
+
+void Physics::RenderVisible(const Camera2D &camera) const {
+  visibleObjects.clear();
+  QueryVisible(Utils::GetCameraWorldRect(camera), visibleObjects);
+  for (const auto *object : visibleObjects) {
+    object->Render();
+  }
+}
+
 void Physics::DrawDebug() const {
   if (!debugDraw)
     return;
+  DrawDebugObjects(objects);
+}
 
-  for (const auto *object : objects) {
+void Physics::DrawDebug(const Camera2D &camera) const {
+  if (!debugDraw)
+    return;
+
+  // Debug shapes sit at the current transform and include fixtures and the
+  // velocity arrow, so test those bounds rather than the render bounds
+  Rectangle view = Utils::GetCameraWorldRect(camera);
+  visibleObjects.clear();
+  for (auto *object : objects) {
+    Rectangle bounds = object->GetAABB();
+    Vector2 arrow = Vector2Scale(object->GetVelocity(), 0.1f);
+    bounds.x += fminf(arrow.x, 0.0f);
+    bounds.y += fminf(arrow.y, 0.0f);
+    bounds.width += fabsf(arrow.x);
+    bounds.height += fabsf(arrow.y);
+    if (CheckCollisionRecs(view, bounds)) {
+      visibleObjects.push_back(object);
+    }
+  }
+  DrawDebugObjects(visibleObjects);
+}
+
+void Physics::DrawDebugObjects(const std::vector<Object *> &list) const {
+  for (const auto *object : list) {
     object->DrawDebug();
   }
 
+  // Draw joints between their anchors
+  for (const auto *joint : joints) {
+    Vector2 anchorA = joint->localAnchorA;
+    if (joint->bodyA) {
+      anchorA = Vector2Add(joint->bodyA->GetPosition(),
+                           Collision::RotatePoint(anchorA, {0, 0},
+                                                  joint->bodyA->GetRotation(),
+                                                  deterministic));
+    }
+    Vector2 anchorB = joint->localAnchorB;
+    if (joint->bodyB) {
+      anchorB = Vector2Add(joint->bodyB->GetPosition(),
+                           Collision::RotatePoint(anchorB, {0, 0},
+                                                  joint->bodyB->GetRotation(),
+                                                  deterministic));
+    }
+    Fumbo::Graphic2D::DrawLineEx(anchorA, anchorB, 1.0f, PURPLE);
+    Fumbo::Graphic2D::DrawCircleV(anchorA, 2.0f, PURPLE);
+    Fumbo::Graphic2D::DrawCircleV(anchorB, 2.0f, PURPLE);
+  }
+
   // Draw gravity direction
   Vector2 gravDir = Vector2Normalize(gravity);
   Vector2 gravStart = {50, 50};
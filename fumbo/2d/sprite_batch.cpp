@@ -0,0 +1,229 @@
+#include "../../fumbo.hpp"
+#include "raymath.h"
+#include "rlgl.h"
+#include <cmath>
+
+namespace Fumbo {
+namespace Graphic2D {
+
+void SpriteBatch::Begin() {
+  sprites.clear();
+  keys.clear();
+}
+
+void SpriteBatch::Reserve(size_t spriteCount) {
+  sprites.reserve(spriteCount);
+  keys.reserve(spriteCount);
+  order.reserve(spriteCount);
+  orderScratch.reserve(spriteCount);
+  keyScratch.reserve(spriteCount);
+}
+
+void SpriteBatch::Draw(Texture2D texture, Rectangle source, Rectangle dest,
+                       Vector2 origin, float rotation, Color tint,
+                       int layer) {
+  if (texture.id == 0)
+    return;
+
+  Push({texture.id, texture.width, texture.height, source, dest, origin,
+        rotation, tint},
+       layer);
+}
+
+void SpriteBatch::Push(const Sprite &sprite, int layer) {
+  sprites.push_back(sprite);
+  // Flipping the sign bit makes signed layers sort as unsigned
+  uint64_t layerBits = (uint32_t)layer ^ 0x80000000u;
+  keys.push_back((layerBits << 32) | sprite.textureId);
+}
+
+void SpriteBatch::DrawWorldSprite(const Object *object, Texture2D texture,
+                                  Rectangle source, Vector2 offset,
+                                  float scale, Color tint, int layer) {
+  if (!object)
+    return;
+
+  // Centered on the object, sized by the source rectangle. A flip stays in
+  // the source; End() draws the destination down and right either way.
+  Rectangle aabb = object->GetInterpolatedAABB();
+  float drawW = fabsf(source.width) * scale;
+  float drawH = fabsf(source.height) * scale;
+  float drawX = aabb.x + aabb.width * 0.5f - drawW * 0.5f + offset.x;
+  float drawY = aabb.y + aabb.height * 0.5f - drawH * 0.5f + offset.y;
+  if (!Utils::IsWorldRectVisible({drawX, drawY, drawW, drawH}))
+    return;
+  Draw(texture, source, {drawX, drawY, drawW, drawH}, {0, 0}, 0.0f, tint,
+       layer);
+}
+
+void SpriteBatch::DrawWorldSpriteAt(Rectangle worldRect, Texture2D texture,
+                                    Rectangle source, Color tint, int layer) {
+  if (!Utils::IsWorldRectVisible(worldRect))
+    return;
+  Draw(texture, source, worldRect, {0, 0}, 0.0f, tint, layer);
+}
+
+bool SpriteBatch::DrawObject(const Object *object, int layer) {
+  if (!object || object->GetShapeType() != ShapeType::Rectangle ||
+      (object->IsOutline() && !object->HasTexture())) {
+    return false;
+  }
+
+  // Centered on the interpolated position, like Object::Render
+  Vector2 position = object->GetInterpolatedPosition();
+  float width = object->GetWidth() * object->GetScale();
+  float height = object->GetHeight() * object->GetScale();
+  Rectangle dest = {position.x, position.y, width, height};
+  Vector2 origin = {width / 2, height / 2};
+  float rotation = object->GetInterpolatedRotation();
+
+  if (object->HasTexture()) {
+    Texture2D texture = object->GetTexture();
+    Draw(texture, {0, 0, (float)texture.width, (float)texture.height}, dest,
+         origin, rotation, WHITE, layer);
+  } else {
+    // Solid fill: raylib's 1x1 white default texture, tinted (its id is 0
+    // on untextured backends, which Draw() would reject)
+    Push({rlGetTextureIdDefault(), 1, 1, {0, 0, 1, 1}, dest, origin, rotation,
+          object->GetColor()},
+         layer);
+  }
+  return true;
+}
+
+void SpriteBatch::SortByKey() {
+  // LSD radix sort on 8-bit digits; stable, so each texture run keeps
+  // submission order. Digits every key shares (most of the layer bits,
+  // the high texture id bits) are skipped.
+  size_t count = keys.size();
+  order.resize(count);
+  orderScratch.resize(count);
+  keyScratch.resize(count);
+  for (size_t i = 0; i < count; i++) {
+    order[i] = (uint32_t)i;
+  }
+
+  for (int shift = 0; shift < 64; shift += 8) {
+    size_t histogram[256] = {0};
+    for (uint64_t key : keys) {
+      histogram[(key >> shift) & 0xFF]++;
+    }
+    if (histogram[(keys[0] >> shift) & 0xFF] == count)
+      continue;
+
+    size_t offset = 0;
+    for (size_t &bucket : histogram) {
+      size_t bucketCount = bucket;
+      bucket = offset;
+      offset += bucketCount;
+    }
+    for (size_t i = 0; i < count; i++) {
+      size_t slot = histogram[(keys[i] >> shift) & 0xFF]++;
+      keyScratch[slot] = keys[i];
+      orderScratch[slot] = order[i];
+    }
+    keys.swap(keyScratch);
+    order.swap(orderScratch);
+  }
+}
+
+void SpriteBatch::End() {
+  stats = {};
+  stats.sprites = (int)sprites.size();
+  if (sprites.empty())
+    return;
+
+  SortByKey();
+
+  Vector2 scale = Utils::GetUITransform().scale;
+  Vector2 offset = Utils::GetUITransform().offset;
+  unsigned int previousTexture = 0;
+  uint32_t previousLayer = ~(uint32_t)(keys[0] >> 32);
+
+  for (size_t i = 0; i < keys.size(); i++) {
+    const Sprite &sprite = sprites[order[i]];
+
+    uint32_t layer = (uint32_t)(keys[i] >> 32);
+    if (layer != previousLayer) {
+      stats.layers++;
+      previousLayer = layer;
+    }
+
+    // A texture change starts a new run (raylib draw call)
+    if (sprite.textureId != previousTexture) {
+      if (i > 0) {
+        rlEnd();
+      }
+      rlSetTexture(sprite.textureId);
+      rlBegin(RL_QUADS);
+      rlNormal3f(0.0f, 0.0f, 1.0f);
+      stats.batches++;
+      previousTexture = sprite.textureId;
+    }
+
+    // Logical space -> screen, same mapping as Graphic2D::DrawTexturePro
+    Rectangle dest = {sprite.dest.x * scale.x + offset.x,
+                      sprite.dest.y * scale.y + offset.y,
+                      fabsf(sprite.dest.width) * scale.x,
+                      fabsf(sprite.dest.height) * scale.y};
+    Vector2 origin = {sprite.origin.x * scale.x, sprite.origin.y * scale.y};
+
+    // Corners, counter-clockwise from the top-left (DrawTexturePro order)
+    Vector2 corners[4];
+    if (sprite.rotation == 0.0f) {
+      float x = dest.x - origin.x;
+      float y = dest.y - origin.y;
+      corners[0] = {x, y};
+      corners[1] = {x, y + dest.height};
+      corners[2] = {x + dest.width, y + dest.height};
+      corners[3] = {x + dest.width, y};
+    } else {
+      float sinRotation = sinf(sprite.rotation * DEG2RAD);
+      float cosRotation = cosf(sprite.rotation * DEG2RAD);
+      const float dx[4] = {-origin.x, -origin.x, dest.width - origin.x,
+                           dest.width - origin.x};
+      const float dy[4] = {-origin.y, dest.height - origin.y,
+                           dest.height - origin.y, -origin.y};
+      for (int c = 0; c < 4; c++) {
+        corners[c] = {dest.x + dx[c] * cosRotation - dy[c] * sinRotation,
+                      dest.y + dx[c] * sinRotation + dy[c] * cosRotation};
+      }
+    }
+
+    // Texture coordinates; negative source sizes flip like raylib
+    Rectangle source = sprite.source;
+    bool flipX = source.width < 0;
+    if (flipX)
+      source.width = -source.width;
+    if (source.height < 0)
+      source.y -= source.height;
+    float u0 = source.x / sprite.textureWidth;
+    float u1 = (source.x + source.width) / sprite.textureWidth;
+    float v0 = source.y / sprite.textureHeight;
+    float v1 = (source.y + source.height) / sprite.textureHeight;
+    if (flipX) {
+      float swap = u0;
+      u0 = u1;
+      u1 = swap;
+    }
+
+    rlColor4ub(sprite.tint.r, sprite.tint.g, sprite.tint.b, sprite.tint.a);
+    rlTexCoord2f(u0, v0);
+    rlVertex2f(corners[0].x, corners[0].y);
+    rlTexCoord2f(u0, v1);
+    rlVertex2f(corners[1].x, corners[1].y);
+    rlTexCoord2f(u1, v1);
+    rlVertex2f(corners[2].x, corners[2].y);
+    rlTexCoord2f(u1, v0);
+    rlVertex2f(corners[3].x, corners[3].y);
+  }
+
+  rlEnd();
+  rlSetTexture(0);
+
+  sprites.clear();
+  keys.clear();
+}
+
+} // namespace Graphic2D
+} // namespace Fumbo
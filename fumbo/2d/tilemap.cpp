@@ -0,0 +1,272 @@
+#include "../../fumbo.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Fumbo {
+namespace Graphic2D {
+
+TileMap::~TileMap() {
+  // States can outlive the window; GPU objects are gone by then
+  if (IsWindowReady()) {
+    Unload();
+  }
+}
+
+void TileMap::Create(int newWidth, int newHeight, float newTileSize,
+                     Texture2D newTileset, int newTilePixels,
+                     Vector2 newOrigin) {
+  Unload();
+
+  width = newWidth > 0 ? newWidth : 0;
+  height = newHeight > 0 ? newHeight : 0;
+  tileSize = newTileSize;
+  origin = newOrigin;
+  tileset = newTileset;
+  tilePixels = newTilePixels > 0 ? newTilePixels : 1;
+  tilesetColumns = std::max(1, tileset.width / tilePixels);
+
+  tiles.assign((size_t)width * height, EMPTY);
+  chunksX = (width + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  chunksY = (height + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  chunks.assign((size_t)chunksX * chunksY, Chunk());
+  stats = {};
+}
+
+void TileMap::Unload() {
+  RenderTargetPool &pool = RenderTargetPool::Instance();
+  for (int index : residentList) {
+    pool.Release(chunks[index].target);
+    chunks[index].resident = false;
+    chunks[index].dirty = true;
+  }
+  residentList.clear();
+}
+
+// Tiles
+
+void TileMap::SetTile(int x, int y, uint16_t tile) {
+  if (x < 0 || y < 0 || x >= width || y >= height)
+    return;
+
+  uint16_t &slot = tiles[(size_t)y * width + x];
+  if (slot == tile)
+    return;
+
+  Chunk &chunk = chunks[(y / CHUNK_SIZE) * chunksX + x / CHUNK_SIZE];
+  chunk.tileCount += (tile != EMPTY) - (slot != EMPTY);
+  chunk.dirty = true;
+  slot = tile;
+}
+
+uint16_t TileMap::GetTile(int x, int y) const {
+  if (x < 0 || y < 0 || x >= width || y >= height)
+    return EMPTY;
+  return tiles[(size_t)y * width + x];
+}
+
+void TileMap::Fill(uint16_t tile) {
+  std::fill(tiles.begin(), tiles.end(), tile);
+  for (int chunkY = 0; chunkY < chunksY; chunkY++) {
+    for (int chunkX = 0; chunkX < chunksX; chunkX++) {
+      // Edge chunks hold fewer tiles
+      int columns = std::min(CHUNK_SIZE, width - chunkX * CHUNK_SIZE);
+      int rows = std::min(CHUNK_SIZE, height - chunkY * CHUNK_SIZE);
+      Chunk &chunk = chunks[chunkY * chunksX + chunkX];
+      chunk.tileCount = tile != EMPTY ? columns * rows : 0;
+      chunk.dirty = true;
+    }
+  }
+}
+
+Rectangle TileMap::GetTileRect(int x, int y) const {
+  return {origin.x + x * tileSize, origin.y + y * tileSize, tileSize,
+          tileSize};
+}
+
+Rectangle TileMap::GetChunkRect(int chunkX, int chunkY) const {
+  float chunkWorld = CHUNK_SIZE * tileSize;
+  return {origin.x + chunkX * chunkWorld, origin.y + chunkY * chunkWorld,
+          chunkWorld, chunkWorld};
+}
+
+bool TileMap::GetChunkRange(Rectangle area, int margin, int &minX, int &minY,
+                            int &maxX, int &maxY) const {
+  float chunkWorld = CHUNK_SIZE * tileSize;
+  minX = (int)std::floor((area.x - origin.x) / chunkWorld) - margin;
+  minY = (int)std::floor((area.y - origin.y) / chunkWorld) - margin;
+  maxX = (int)std::floor((area.x + area.width - origin.x) / chunkWorld) +
+         margin;
+  maxY = (int)std::floor((area.y + area.height - origin.y) / chunkWorld) +
+         margin;
+  if (maxX < 0 || maxY < 0 || minX >= chunksX || minY >= chunksY)
+    return false;
+
+  minX = std::max(minX, 0);
+  minY = std::max(minY, 0);
+  maxX = std::min(maxX, chunksX - 1);
+  maxY = std::min(maxY, chunksY - 1);
+  return true;
+}
+
+Rectangle TileMap::GetTileSource(uint16_t tile) const {
+  int index = tile - 1;
+  return {(float)(index % tilesetColumns * tilePixels),
+          (float)(index / tilesetColumns * tilePixels), (float)tilePixels,
+          (float)tilePixels};
+}
+
+// Streaming
+
+void TileMap::Update(const Camera2D &camera) {
+  stats.rebuiltChunks = 0;
+  if (chunks.empty())
+    return;
+
+  Rectangle view = Utils::GetCameraWorldRect(camera);
+
+  // Release targets that drifted out of range (one chunk of hysteresis so a
+  // camera hovering on a boundary doesn't thrash)
+  int minX, minY, maxX, maxY;
+  bool keepAny =
+      GetChunkRange(view, streamMargin + 1, minX, minY, maxX, maxY);
+  for (size_t i = residentList.size(); i > 0; i--) {
+    int index = residentList[i - 1];
+    int chunkX = index % chunksX;
+    int chunkY = index / chunksX;
+    bool inRange = keepAny && chunkX >= minX && chunkX <= maxX &&
+                   chunkY >= minY && chunkY <= maxY;
+    if (!inRange || chunks[index].tileCount == 0) {
+      ReleaseChunk(index);
+    }
+  }
+
+  // Build stale chunks, on-screen ones first, then the streaming margin
+  for (int margin : {0, streamMargin}) {
+    if (!GetChunkRange(view, margin, minX, minY, maxX, maxY))
+      continue;
+    for (int chunkY = minY; chunkY <= maxY; chunkY++) {
+      for (int chunkX = minX; chunkX <= maxX; chunkX++) {
+        if (stats.rebuiltChunks >= maxRebuildsPerFrame)
+          break;
+        const Chunk &chunk = chunks[chunkY * chunksX + chunkX];
+        if (chunk.tileCount > 0 && (!chunk.resident || chunk.dirty)) {
+          BuildChunk(chunkX, chunkY);
+        }
+      }
+    }
+  }
+
+  stats.residentChunks = (int)residentList.size();
+}
+
+void TileMap::BuildChunk(int chunkX, int chunkY) {
+  int index = chunkY * chunksX + chunkX;
+  Chunk &chunk = chunks[index];
+
+  if (!chunk.resident) {
+    // Pooled: chunks streaming in reuse the targets of those streaming out
+    chunk.target = RenderTargetPool::Instance().Acquire(
+        CHUNK_SIZE * tilePixels, CHUNK_SIZE * tilePixels);
+    chunk.resident = true;
+    residentList.push_back(index);
+  }
+
+  // Tiles at native atlas resolution; the chunk is scaled when drawn
+  BeginTextureMode(chunk.target);
+  ClearBackground(BLANK);
+  int firstX = chunkX * CHUNK_SIZE;
+  int firstY = chunkY * CHUNK_SIZE;
+  int lastX = std::min(firstX + CHUNK_SIZE, width);
+  int lastY = std::min(firstY + CHUNK_SIZE, height);
+  for (int y = firstY; y < lastY; y++) {
+    for (int x = firstX; x < lastX; x++) {
+      uint16_t tile = tiles[(size_t)y * width + x];
+      if (tile == EMPTY)
+        continue;
+      Rectangle dest = {(float)((x - firstX) * tilePixels),
+                        (float)((y - firstY) * tilePixels), (float)tilePixels,
+                        (float)tilePixels};
+      ::DrawTexturePro(tileset, GetTileSource(tile), dest, {0, 0}, 0.0f,
+                       WHITE);
+    }
+  }
+  EndTextureMode();
+
+  chunk.dirty = false;
+  stats.rebuiltChunks++;
+}
+
+void TileMap::ReleaseChunk(int index) {
+  Chunk &chunk = chunks[index];
+  if (!chunk.resident)
+    return;
+
+  RenderTargetPool::Instance().Release(chunk.target);
+  chunk.resident = false;
+  chunk.dirty = true;
+
+  auto it = std::find(residentList.begin(), residentList.end(), index);
+  *it = residentList.back();
+  residentList.pop_back();
+}
+
+// Rendering
+
+void TileMap::Draw(const Camera2D &camera) {
+  stats.visibleChunks = 0;
+  stats.drawCalls = 0;
+
+  Rectangle view = Utils::GetCameraWorldRect(camera);
+  int minX, minY, maxX, maxY;
+  if (chunks.empty() || !GetChunkRange(view, 0, minX, minY, maxX, maxY))
+    return;
+
+  for (int chunkY = minY; chunkY <= maxY; chunkY++) {
+    for (int chunkX = minX; chunkX <= maxX; chunkX++) {
+      const Chunk &chunk = chunks[chunkY * chunksX + chunkX];
+      if (chunk.tileCount == 0)
+        continue;
+
+      stats.visibleChunks++;
+      stats.drawCalls++;
+      if (chunk.resident && !chunk.dirty) {
+        // Render textures are stored upside down
+        Rectangle source = {0, 0, (float)chunk.target.texture.width,
+                            -(float)chunk.target.texture.height};
+        Fumbo::Graphic2D::DrawTexturePro(chunk.target.texture, source,
+                                         GetChunkRect(chunkX, chunkY), {0, 0},
+                                         0.0f, WHITE);
+      } else {
+        DrawChunkTiles(chunkX, chunkY, view);
+      }
+    }
+  }
+}
+
+void TileMap::DrawChunkTiles(int chunkX, int chunkY, Rectangle view) const {
+  // Only the tiles of this chunk that overlap the view
+  int firstX = std::max(chunkX * CHUNK_SIZE,
+                        (int)std::floor((view.x - origin.x) / tileSize));
+  int firstY = std::max(chunkY * CHUNK_SIZE,
+                        (int)std::floor((view.y - origin.y) / tileSize));
+  int lastX = std::min({(chunkX + 1) * CHUNK_SIZE, width,
+                        (int)std::ceil((view.x + view.width - origin.x) /
+                                       tileSize)});
+  int lastY = std::min({(chunkY + 1) * CHUNK_SIZE, height,
+                        (int)std::ceil((view.y + view.height - origin.y) /
+                                       tileSize)});
+
+  for (int y = firstY; y < lastY; y++) {
+    for (int x = firstX; x < lastX; x++) {
+      uint16_t tile = tiles[(size_t)y * width + x];
+      if (tile != EMPTY) {
+        Fumbo::Graphic2D::DrawTexturePro(tileset, GetTileSource(tile),
+                                         GetTileRect(x, y), {0, 0}, 0.0f,
+                                         WHITE);
+      }
+    }
+  }
+}
+
+} // namespace Graphic2D
+} // namespace Fumbo
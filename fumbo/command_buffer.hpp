@@ -0,0 +1,115 @@
+#pragma once
+#include "raylib.h"
+#include <cstdint>
+#include <vector>
+
+namespace Fumbo {
+namespace Graphic2D {
+
+// Recorded draw calls, replayable later. Commands are small POD records in
+// one linear arena, stored in UI space with the arguments the Graphic2D
+// wrappers took, so a kept buffer replays correctly after a resize and can
+// be cached across frames: record once, Replay() every frame, Clear() and
+// re-record when the content changes.
+//
+// While a buffer is recording on a thread, these Graphic2D wrappers record
+// into it instead of drawing: DrawTexture, DrawTexturePro, DrawBackground,
+// DrawText, DrawRectangle/V/Rec/Pro, DrawRectangleLinesEx, DrawCircle/V,
+// DrawCircleLinesV, DrawLineV/Ex and DrawTriangle. Anything else (raw
+// raylib calls, other wrappers, SpriteBatch::End) still draws immediately.
+// Recording never touches the GPU, so separate buffers can be filled on
+// worker threads, then Append()ed and replayed on the main thread.
+class CommandBuffer {
+public:
+  // Routes this thread's Graphic2D wrappers into the buffer until
+  // EndRecording(). Recording is per thread and doesn't nest.
+  void BeginRecording();
+  void EndRecording();
+  static CommandBuffer *GetRecording(); // This thread's, or nullptr
+
+  void Clear(); // Keeps the arena's capacity
+
+  // State for the commands recorded after it
+  void SetLayer(int layer) { currentLayer = layer; }
+  void SetShader(Shader shader);
+  void ResetShader() { currentShader = 0; }
+
+  // Copies other's commands (layers and shaders included) after ours
+  void Append(const CommandBuffer &other);
+  // Stable reorder: by layer, then (groupByState) shader and texture to cut
+  // state changes. Grouping can reorder overlapping draws within a layer,
+  // like SpriteBatch; sort by layer alone when they must stack.
+  void Sort(bool groupByState = true);
+  // Submits the commands through the Graphic2D wrappers, in order
+  void Replay() const;
+
+  size_t GetCommandCount() const { return commands.size(); }
+  size_t GetArenaSize() const { return arena.size(); } // Payload bytes
+  bool IsEmpty() const { return commands.empty(); }
+
+  // Recording, same arguments as the Graphic2D wrappers
+  void DrawTexture(Texture2D texture, Vector2 basePos, Vector2 baseSize,
+                   float rotation, Color tint);
+  void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest,
+                      Vector2 origin, float rotation, Color tint);
+  void DrawBackground(Texture2D backgroundTex);
+  void DrawText(const char *text, Vector2 basePos, Font font,
+                int baseFontSize, Color color);
+  void DrawRectangle(int posX, int posY, int width, int height, Color color);
+  void DrawRectangleV(Vector2 position, Vector2 size, Color color);
+  void DrawRectangleRec(Rectangle rectangle, Color color);
+  void DrawRectanglePro(Rectangle rectangle, Vector2 origin, float rotation,
+                        Color color);
+  void DrawRectangleLinesEx(Rectangle rectangle, float lineThick,
+                            Color color);
+  void DrawCircle(int centerX, int centerY, float radius, Color color);
+  void DrawCircleV(Vector2 center, float radius, Color color);
+  void DrawCircleLinesV(Vector2 center, float radius, Color color);
+  void DrawLineV(Vector2 startPos, Vector2 endPos, Color color);
+  void DrawLineEx(Vector2 startPos, Vector2 endPos, float thickness,
+                  Color color);
+  void DrawTriangle(Vector2 vertex1, Vector2 vertex2, Vector2 vertex3,
+                    Color color);
+
+private:
+  enum class CommandType : uint8_t {
+    Texture,
+    TexturePro,
+    Background,
+    Text,
+    Rectangle,
+    RectangleV,
+    RectangleRec,
+    RectanglePro,
+    RectangleLinesEx,
+    Circle,
+    CircleV,
+    CircleLinesV,
+    LineV,
+    LineEx,
+    Triangle,
+  };
+
+  struct Command {
+    CommandType type;
+    uint16_t shader;    // Slot in shaders, 0 = default
+    int32_t layer;
+    uint32_t textureId; // Sorting only; 0 for shapes
+    uint32_t offset;    // Payload start in the arena
+  };
+
+  std::vector<Command> commands;
+  std::vector<uint8_t> arena;
+  std::vector<Shader> shaders; // Slot 0 is unused
+  int currentLayer = 0;
+  uint16_t currentShader = 0;
+
+  template <typename Payload>
+  void Record(CommandType type, uint32_t textureId, const Payload &payload,
+              const void *extra = nullptr, size_t extraSize = 0);
+  template <typename Payload> Payload Read(uint32_t offset) const;
+  void ReplayCommand(const Command &command) const;
+};
+
+} // namespace Graphic2D
+} // namespace Fumbo
@@ -0,0 +1,98 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace Fumbo {
+namespace Utils {
+
+struct FrameAllocatorStats {
+  size_t used = 0;     // Bytes handed out since BeginFrame()
+  size_t peak = 0;     // Most bytes any frame has used
+  size_t capacity = 0; // Bytes reserved across blocks
+  int blockAllocations = 0; // Blocks taken from the heap, ever
+  // operator new calls during the last Engine::Draw; -1 unless built with
+  // FUMBO_COUNT_HEAP_ALLOCS
+  long heapAllocations = -1;
+};
+
+// operator new calls in the whole process so far; -1 unless built with
+// FUMBO_COUNT_HEAP_ALLOCS. Diff two reads to count a section's allocations.
+long GetHeapAllocationCount();
+
+// Per-frame scratch memory: a bump allocator Engine::Draw resets every
+// frame. Allocations are never freed individually and must not outlive the
+// frame; only trivially destructible data belongs here. When a frame
+// overflows, another block is chained on and the next BeginFrame() merges
+// them, so steady-state frames don't touch the heap. Main thread only.
+//
+// Code that may run outside Engine::Draw (or many times per frame) should
+// wrap its scratch in a Scope, which hands the memory back on exit.
+class FrameAllocator {
+public:
+  static FrameAllocator &Instance() {
+    static FrameAllocator instance;
+    return instance;
+  }
+
+  void *Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+  // Uninitialized storage for `count` elements
+  template <typename T> T *AllocateArray(size_t count) {
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "Frame memory is never destroyed");
+    return static_cast<T *>(Allocate(sizeof(T) * count, alignof(T)));
+  }
+
+  // NUL-terminated copy of the first `length` characters
+  const char *CopyString(const char *text, size_t length);
+
+  // Releases everything allocated after its construction
+  class Scope {
+  public:
+    Scope();
+    ~Scope();
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+  private:
+    size_t block;
+    size_t offset;
+    size_t usedBefore;
+  };
+
+  // Engine::Draw brackets each frame with these
+  void BeginFrame();
+  void EndFrame();
+
+  // Debug: warn and assert when a frame's Draw hits operator new. Needs a
+  // FUMBO_COUNT_HEAP_ALLOCS build; a no-op otherwise.
+  void SetExpectNoHeapAllocations(bool expect) { expectNoHeap = expect; }
+  const FrameAllocatorStats &GetStats() const { return stats; }
+
+private:
+  FrameAllocator() = default;
+  ~FrameAllocator() = default;
+  FrameAllocator(const FrameAllocator &) = delete;
+  FrameAllocator &operator=(const FrameAllocator &) = delete;
+
+  struct Block {
+    std::unique_ptr<uint8_t[]> data;
+    size_t size;
+  };
+
+  std::vector<Block> blocks;
+  size_t currentBlock = 0;
+  size_t currentOffset = 0;
+  size_t usedInEarlierBlocks = 0; // Filled blocks before currentBlock
+  bool expectNoHeap = false;
+  long heapAtFrameStart = 0;
+  FrameAllocatorStats stats;
+
+  void AddBlock(size_t minimumSize);
+};
+
+} // namespace Utils
+} // namespace Fumbo
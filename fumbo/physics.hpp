@@ -4,6 +4,7 @@
 #include <vector>
 #include <cmath>
 #include <cstdint>
+#include <memory>
 
 namespace Fumbo {
 namespace Graphic2D {
@@ -13,8 +14,9 @@ enum class ShapeType { Rectangle, Circle, Triangle, Polygon, Line };
 
 // Body type determines physics behavior
 enum class BodyType {
-  Static, // Doesn't move, but can collide
-  Dynamic // Affected by gravity and forces
+  Static,   // Doesn't move, but can collide
+  Dynamic,  // Affected by gravity and forces
+  Kinematic // Moved by game code (MoveAndSlide/SetPosition), ignores forces
 };
 
 // Collision data for contact resolution
@@ -23,16 +25,35 @@ struct CollisionContact {
   Vector2 normal;    // Collision normal (from A to B)
   float penetration; // Penetration depth
   bool hasCollision; // Whether collision occurred
+
+  // Clipped contact manifold (polygon pairs); `point` is their average.
+  // pointCount is 0 when only `point` is known. depths[i] is the
+  // penetration at points[i]; a tilted box touches deeper at one corner.
+  Vector2 points[2];
+  float depths[2] = {0.0f, 0.0f};
+  int pointCount = 0;
+
+  // Which fixture of each object touched (0 = the object's own shape)
+  int fixtureA = 0;
+  int fixtureB = 0;
 };
 
-// Forward declaration
+// Forward declarations
 class Object;
+class Physics;
 
 // === FUMBO Collision
 namespace Collision {
 
-// Main collision detection dispatcher
-CollisionContact CheckCollision(const Object *a, const Object *b);
+// Main collision detection dispatcher. `axisHint` is optional per-pair
+// state for polygon tests (see PolygonVsPolygon); start it at -1. Objects
+// with fixtures test every fixture pair and report the deepest contact,
+// solid fixtures taking priority over triggers.
+CollisionContact CheckCollision(const Object *a, const Object *b,
+                                int *axisHint = nullptr);
+// Same, but only the objects' own shapes (fixture 0)
+CollisionContact CheckShapeCollision(const Object *a, const Object *b,
+                                     int *axisHint = nullptr);
 
 // Shape-specific collision checks
 CollisionContact RectangleVsRectangle(Vector2 posA, float widthA, float heightA,
@@ -46,16 +67,59 @@ CollisionContact RectangleVsCircle(Vector2 rectPos, float width, float height,
                                    float rotation, Vector2 circlePos,
                                    float radius);
 
+// Convex polygon in world space: normals[i] is the unit outward normal of
+// the edge vertices[i] -> vertices[i + 1]
+struct PolygonView {
+  const Vector2 *vertices;
+  const Vector2 *normals;
+  int count;
+};
+
+// SAT over precomputed face normals with clipped contact points. If given,
+// `axisHint` holds the axis that decided this pair's previous test; it is
+// tried first (cheap early-out for pairs that stay apart) and updated.
+CollisionContact PolygonVsPolygon(const PolygonView &a, const PolygonView &b,
+                                  int *axisHint = nullptr);
 CollisionContact PolygonVsPolygon(const std::vector<Vector2> &vertsA,
                                   const std::vector<Vector2> &vertsB);
 
+CollisionContact PolygonVsCircle(const PolygonView &poly, Vector2 circlePos,
+                                 float radius);
 CollisionContact PolygonVsCircle(const std::vector<Vector2> &verts,
                                  Vector2 circlePos, float radius);
 
-// Helper functions
-Vector2 RotatePoint(Vector2 point, Vector2 origin, float angle);
+// Segment shapes are capsules: the segment inflated by `segmentRadius`
+// (0 for a bare segment)
+CollisionContact SegmentVsCircle(Vector2 start, Vector2 end,
+                                 float segmentRadius, Vector2 circlePos,
+                                 float radius);
+CollisionContact SegmentVsPolygon(Vector2 start, Vector2 end,
+                                  float segmentRadius,
+                                  const PolygonView &poly);
+CollisionContact SegmentVsSegment(Vector2 startA, Vector2 endA, float radiusA,
+                                  Vector2 startB, Vector2 endB, float radiusB);
+
+// Helper functions. `portable` picks PortableSinCos over sinf/cosf; object
+// checks pass their world's setting (Object::UsesPortableTrig).
+Vector2 RotatePoint(Vector2 point, Vector2 origin, float angle,
+                    bool portable = false);
+
+// Portable sine/cosine (degrees) from a lookup table built with plain IEEE
+// arithmetic, so every platform gets bit-identical results. Deterministic
+// worlds (Physics::SetDeterministic) rotate their bodies with it. Either
+// output pointer may be null.
+void PortableSinCos(float degrees, float *sine, float *cosine);
 std::vector<Vector2> GetRectangleVertices(Vector2 pos, float width,
-                                          float height, float rotation);
+                                          float height, float rotation,
+                                          bool portable = false);
+// Unit outward edge normals of a convex polygon of either winding
+// (degenerate edges get a zero normal and are skipped by the SAT)
+void ComputeEdgeNormals(const Vector2 *vertices, int count, Vector2 *normals);
+bool IsConvex(const std::vector<Vector2> &polygon);
+// Split a simple (non self-intersecting) polygon into convex pieces, in the
+// input's winding. A convex input comes back as a single piece.
+std::vector<std::vector<Vector2>>
+DecomposeConvex(const std::vector<Vector2> &polygon);
 Rectangle GetBoundingBox(const std::vector<Vector2> &vertices);
 bool LineIntersection(Vector2 p1, Vector2 p2, Vector2 p3, Vector2 p4,
                       Vector2 *intersection = nullptr);
@@ -87,6 +151,17 @@ private:
   uint32_t layerMask;
 };
 
+// Extra shape attached to an Object (foot sensor, hurtbox, ...). It moves
+// and rotates with the body and shares its broadphase entry.
+struct Fixture {
+  ShapeType shape = ShapeType::Rectangle; // Rectangle or Circle
+  Vector2 offset = {0, 0};                // Center relative to the body
+  Vector2 size = {0, 0};                  // Rectangle width/height
+  float radius = 0.0f;                    // Circle radius
+  bool isTrigger = false; // Reports contacts but is never solved
+  CollisionLayers layers;
+};
+
 // 2D Physics Object with shape and rigidbody
 class Object {
 public:
@@ -97,11 +172,26 @@ public:
   void SetRectangle(float width, float height);
   void SetCircle(float radius);
   void SetTriangle(Vector2 p1, Vector2 p2, Vector2 p3);
+  // Concave outlines are decomposed into convex pieces that collide as one
+  // body (one broadphase entry); the outline is kept for drawing/raycasts
   void SetPolygon(const std::vector<Vector2> &vertices);
   void SetLine(Vector2 start, Vector2 end);
 
   ShapeType GetShapeType() const { return shapeType; }
 
+  // Stable id assigned when the object is added to a world (0 = none).
+  // Used to order pair processing and raycast ties deterministically.
+  uint32_t GetId() const { return id; }
+
+  // True when the object lives in a world's body pool (Physics::CreateBody)
+  bool IsPooled() const { return poolSlot != INVALID_SLOT; }
+
+  // World the object was added to (nullptr = none)
+  Physics *GetWorld() const { return world; }
+  // True in a deterministic world (or for a fixture stand-in of a body in
+  // one): rotations use Collision::PortableSinCos
+  bool UsesPortableTrig() const;
+
   // ===== Transform =====
   void SetPosition(Vector2 pos) { position = pos; }
   Vector2 GetPosition() const { return position; }
@@ -112,6 +202,16 @@ public:
   void SetScale(float scl) { scale = scl; }
   float GetScale() const { return scale; }
 
+  // ===== Interpolation =====
+  // Transform blended between the last two fixed physics steps, for
+  // rendering. Call ResetInterpolation() after teleporting a body so it
+  // doesn't smear across the jump for one frame. The AABB is the object's
+  // own shape only (what sprites are drawn over), not its fixtures.
+  Vector2 GetInterpolatedPosition() const;
+  float GetInterpolatedRotation() const;
+  Rectangle GetInterpolatedAABB() const;
+  void ResetInterpolation();
+
   // ===== Rigidbody Properties =====
   void SetBodyType(BodyType type) { bodyType = type; }
   BodyType GetBodyType() const { return bodyType; }
@@ -134,9 +234,28 @@ public:
   void SetGravityScale(float gs) { gravityScale = gs; }
   float GetGravityScale() const { return gravityScale; }
 
+  // Degrees per second, like rotation. Drag slows spin as well.
+  void SetAngularVelocity(float av) { angularVelocity = av; }
+  float GetAngularVelocity() const { return angularVelocity; }
+
+  // Moment of inertia about the position, from shape, mass and scale
+  float GetInertia() const;
+  // Inverse inertia the solver uses (per radian); 0 for non-dynamic,
+  // fixed-rotation and line bodies, which never spin
+  float GetInverseInertia() const;
+
+  // Keep rotation constant under contacts and joints (characters)
+  void SetFixedRotation(bool fixed) { fixedRotation = fixed; }
+  bool IsFixedRotation() const { return fixedRotation; }
+
   // ===== Physics Simulation =====
+  // Points are in world space; off-center forces and impulses also spin
+  // the body
   void ApplyForce(Vector2 force);
+  void ApplyForceAtPoint(Vector2 force, Vector2 point);
+  void ApplyTorque(float torque);
   void ApplyImpulse(Vector2 impulse);
+  void ApplyImpulseAtPoint(Vector2 impulse, Vector2 point);
   void Update(float deltaTime);
 
   // ===== Collision =====
@@ -156,14 +275,54 @@ public:
   // Check if this object is currently colliding with another
   bool IsCollidingWith(const Object *other) const;
 
+  // ===== Fixtures =====
+  // Fixture 0 is the object's own shape; added fixtures are numbered from 1.
+  // Contacts and raycast hits report the fixture index that touched.
+  static constexpr int MAX_FIXTURES = 4;
+
+  int AddFixture(const Fixture &fixture); // Returns the index, -1 when full
+  void ClearFixtures() { extraFixtureCount = 0; }
+  int GetFixtureCount() const { return 1 + extraFixtureCount; }
+  Fixture &GetFixture(int index) { return fixtures[index - 1]; }
+  const Fixture &GetFixture(int index) const { return fixtures[index - 1]; }
+
+  // Trigger state of one fixture (the whole object's trigger flag applies
+  // to every fixture)
+  bool IsFixtureTrigger(int index) const;
+  bool IsFixtureCollidingWith(int index, const Object *other) const;
+  Rectangle GetFixtureAABB(int index) const;
+
+  // Sets `out` up as a stand-alone shape matching fixture `index` in world
+  // space (used by the narrow phase and raycasts), with this object's trig
+  // mode
+  void MakeFixtureShape(int index, Object &out) const;
+
   // ===== Shape-Specific Getters =====
   float GetWidth() const { return width; }
   float GetHeight() const { return height; }
   float GetRadius() const { return radius; }
-  std::vector<Vector2> GetVertices() const;
+  Vector2 GetLineStart() const { return lineStart; } // Relative to position
+  Vector2 GetLineEnd() const { return lineEnd; }
+  // World-space outline (polygons, triangles, rectangles). Cached until the
+  // transform or shape changes, so it's rebuilt at most once per step.
+  const std::vector<Vector2> &GetVertices() const;
+
+  // Polygon/Triangle data in local space (unscaled, unrotated)
+  const std::vector<Vector2> &GetLocalVertices() const { return vertices; }
+  const std::vector<Vector2> &GetLocalNormals() const { return normals; }
+
+  // Convex pieces used for collision: the polygon itself when convex
+  bool IsConcave() const { return !pieces.empty(); }
+  int GetConvexPieceCount() const {
+    return pieces.empty() ? 1 : (int)pieces.size();
+  }
+  Collision::PolygonView GetLocalConvexPiece(int index) const;
 
-  // Get axis-aligned bounding box (for broadphase collision detection)
+  // Get axis-aligned bounding box (for broadphase collision detection);
+  // covers every fixture
   Rectangle GetAABB() const;
+  // Bounding box of the object's own shape only (fixture 0)
+  Rectangle GetShapeAABB() const;
 
   // ===== Rendering =====
   void SetColor(Color c) { color = c; }
@@ -176,6 +335,7 @@ public:
   }
   void ClearTexture() { hasTexture = false; }
   bool HasTexture() const { return hasTexture; }
+  Texture2D GetTexture() const { return texture; }
 
   void SetOutline(bool outline) { isOutline = outline; }
   bool IsOutline() const { return isOutline; }
@@ -189,21 +349,57 @@ public:
   void DrawDebug() const;
 
 private:
+  friend class Physics;
+
+  // The two halves of Update(); Physics solves joint velocities in between
+  void IntegrateVelocity(float deltaTime);
+  void IntegratePosition(float deltaTime);
+
   // Shape properties
   ShapeType shapeType;
   float width, height;           // Rectangle
   float radius;                  // Circle
   std::vector<Vector2> vertices; // Polygon/Triangle
+  std::vector<Vector2> normals;  // Edge normals of `vertices` (local)
+
+  // Convex decomposition of a concave polygon, packed into flat arrays
+  // (empty when the polygon is convex)
+  struct ConvexPiece {
+    int first;
+    int count;
+  };
+  std::vector<ConvexPiece> pieces;
+  std::vector<Vector2> pieceVertices;
+  std::vector<Vector2> pieceNormals;
 
   // Transform
   Vector2 position;
   float rotation;
   float scale;
 
+  // Transform at the start of the last fixed step (for interpolation)
+  Vector2 previousPosition;
+  float previousRotation;
+  Physics *world = nullptr; // World this object was added to
+  uint32_t id = 0;
+  // Fixture stand-ins belong to no world; MakeFixtureShape copies the
+  // owner's trig mode here instead
+  bool portableTrig = false;
+
+  // Bookkeeping owned by Physics: slot in the world's object list (O(1)
+  // removal) and in its body pool (handle lookup)
+  static constexpr uint32_t INVALID_SLOT = 0xFFFFFFFF;
+  uint32_t worldSlot = INVALID_SLOT;
+  uint32_t poolSlot = INVALID_SLOT;
+
   // Rigidbody
   BodyType bodyType;
   Vector2 velocity;
   Vector2 acceleration;
+  float angularVelocity = 0.0f; // Degrees per second
+  float torque = 0.0f;          // Accumulated until the next step
+  float unitInertia = 0.0f;     // Inertia per unit mass at scale 1
+  bool fixedRotation = false;
   float mass;
   float friction;     // 0 = frictionless, 1 = high friction
   float drag;         // Air resistance
@@ -215,6 +411,10 @@ private:
   bool isCollidable = true; // Can this object collide?
   CollisionLayers collisionLayers;
 
+  // Fixtures 1..extraFixtureCount, stored inline
+  Fixture fixtures[MAX_FIXTURES];
+  int extraFixtureCount = 0;
+
   // Visual
   Color color;
   Texture2D texture;
@@ -226,10 +426,117 @@ private:
   Vector2 lineStart;
   Vector2 lineEnd;
 
+  // World vertex cache and the transform it was built for
+  mutable std::vector<Vector2> worldVertices;
+  mutable Vector2 cachedPosition = {0, 0};
+  mutable float cachedRotation = 0.0f;
+  mutable float cachedScale = 0.0f;
+  mutable bool cachedPortable = false;
+  mutable bool verticesCached = false;
+
   // Helper to update vertices for transform
-  void UpdateVertices();
+  void UpdateVertices() const;
+  std::vector<Vector2> GetVerticesAt(Vector2 pos, float rot) const;
+  void ComputeUnitInertia();
+};
+
+// Configuration struct for easy object setup
+struct ObjectConfig {
+  // Shape
+  Vector2 size = {100, 100};
+
+  // Physics
+  float mass = 1.0f;
+  float friction = 0.0f;
+  float restitution = 0.0f;
+  float gravityScale = 1.0f;
+  BodyType bodyType = BodyType::Dynamic;
+  bool fixedRotation = false;
+
+  // Visual
+  Color color = WHITE;
+  Texture2D texture = {0};
+  bool hasTexture = false;
+
+  // Position
+  Vector2 position = {0, 0};
+};
+
+// Apply configuration to an object
+inline void ConfigureObject(Object *obj, const ObjectConfig &config) {
+  obj->SetRectangle(config.size.x, config.size.y);
+  obj->SetPosition(config.position);
+  obj->SetMass(config.mass);
+  obj->SetFriction(config.friction);
+  obj->SetRestitution(config.restitution);
+  obj->SetGravityScale(config.gravityScale);
+  obj->SetBodyType(config.bodyType);
+  obj->SetFixedRotation(config.fixedRotation);
+  obj->SetColor(config.color);
+
+  if (config.hasTexture && config.texture.id != 0) {
+    obj->SetTexture(config.texture);
+  }
+}
+
+// Generational handle to a body created with Physics::CreateBody. Handles
+// to destroyed bodies are detected instead of dangling.
+struct BodyHandle {
+  uint32_t index = 0;
+  uint32_t generation = 0; // 0 = null handle
+
+  bool IsNull() const { return generation == 0; }
+  bool operator==(const BodyHandle &other) const {
+    return index == other.index && generation == other.generation;
+  }
+  bool operator!=(const BodyHandle &other) const { return !(*this == other); }
+};
+
+// Joint kinds solved by Physics
+enum class JointType {
+  Distance,  // Keeps the anchors `length` apart
+  Revolute,  // Pins the anchors together
+  Weld,      // Pins the anchors and locks relative rotation
+  Prismatic, // B slides along A's `localAxis`, relative rotation locked
+  Rope       // Anchors at most `length` apart, slack when closer
 };
 
+// Constraint between two bodies. The caller owns it (like Object) and
+// registers it with Physics::AddJoint; the Make*Joint helpers fill anchors
+// from world-space points.
+struct Joint {
+  JointType type = JointType::Distance;
+  Object *bodyA = nullptr; // Null = fixed to the world (anchor A in world)
+  Object *bodyB = nullptr;
+  Vector2 localAnchorA = {0, 0}; // Relative to the body, rotates with it
+  Vector2 localAnchorB = {0, 0};
+  float length = 0.0f;         // Distance: rest length, Rope: max length
+  Vector2 localAxis = {1, 0};  // Prismatic: slide axis in A's frame
+  float referenceAngle = 0.0f; // Weld/Prismatic: rotation B - A to hold
+  bool enableLimit = false;    // Prismatic: clamp translation along the axis
+  float lowerTranslation = 0.0f;
+  float upperTranslation = 0.0f;
+  float stiffness = 1.0f; // Share of position error removed per iteration
+  bool collideConnected = false; // Let the two bodies still collide
+
+  // Managed by Physics
+  Physics *world = nullptr;
+  uint32_t worldSlot = 0;
+  Vector2 impulse = {0, 0}; // Accumulated solver impulses (warm start)
+  float angularImpulse = 0.0f; // Rotation lock (warm start)
+  Vector2 armA = {0, 0}; // Anchor arms for this step's velocity pass
+  Vector2 armB = {0, 0};
+};
+
+// Joint builders (anchors and axis in world space, from current transforms)
+Joint MakeDistanceJoint(Object *a, Object *b, Vector2 anchorA,
+                        Vector2 anchorB);
+Joint MakeRopeJoint(Object *a, Object *b, Vector2 anchorA, Vector2 anchorB,
+                    float maxLength);
+Joint MakeRevoluteJoint(Object *a, Object *b, Vector2 anchor);
+Joint MakeWeldJoint(Object *a, Object *b, Vector2 anchor);
+Joint MakePrismaticJoint(Object *a, Object *b, Vector2 anchor, Vector2 axis);
+
 // Raycast result structure
 struct RaycastHit {
   Object *object;
@@ -237,9 +544,105 @@ struct RaycastHit {
   Vector2 normal;
   float distance;
   bool hit;
+  int fixture = 0; // Fixture of `object` that was hit
+};
+
+// Result of Physics::MoveAndSlide
+struct MoveResult {
+  Vector2 motion;       // Motion actually applied after sliding
+  Vector2 floorNormal;  // Normal of the last floor touched
+  Vector2 wallNormal;   // Normal of the last wall touched
+  Object *floorObject;  // Body the mover is standing on (if any)
+  bool onFloor;         // Touched a surface facing up
+  bool onWall;          // Touched a surface facing sideways
+  bool onCeiling;       // Touched a surface facing down
+  int collisionCount;   // Number of contacts resolved during the move
+};
+
+// Compact per-body state captured by Physics::SaveSnapshot. Plain data so a
+// whole world copies in one linear pass.
+struct BodyState {
+  Vector2 position;
+  Vector2 previousPosition;
+  Vector2 velocity;
+  Vector2 acceleration;
+  float rotation;
+  float previousRotation;
+  float angularVelocity;
+  float torque;
+  uint32_t id;
+};
+
+// Solver state a touching pair of bodies carries from one step to the next:
+// the last manifold and the impulses that held it, used to warm start the
+// pair. Saved with snapshots so a replay solves exactly like the original.
+struct PairState {
+  uint32_t idA, idB;   // Body ids, idA < idB
+  int axisHint = -1;   // SAT axis that decided the last test
+  Vector2 normal = {0, 0};
+  Vector2 points[2] = {{0, 0}, {0, 0}};
+  int pointCount = 0;
+  float normalImpulses[2] = {0.0f, 0.0f};
+  float tangentImpulses[2] = {0.0f, 0.0f};
+};
+
+// A joint's warm start, saved with snapshots for the same reason
+struct JointState {
+  Vector2 impulse;
+  float angularImpulse;
+};
+
+// Saved world state for rollback and fast level resets. Reserve() once up
+// front (e.g. a ring of 8 for rollback netcode) and saving never allocates.
+// Objects and joints referenced by a snapshot must stay alive while it is
+// in use.
+struct PhysicsSnapshot {
+  std::vector<Object *> objects;
+  std::vector<BodyState> bodies;
+  std::vector<uint32_t> poolGenerations; // Body pool slots (CreateBody)
+  std::vector<uint32_t> poolFreeSlots;
+  std::vector<PairState> pairs;
+  std::vector<Joint *> joints;
+  std::vector<JointState> jointStates;
+  float accumulator = 0.0f;
+  float lastSubstepTime = 0.0f;
+  uint32_t nextBodyId = 1;
+
+  // Pool slots come in blocks of 64; bodyCount should cover them too.
+  // A resting body touches about two others.
+  void Reserve(size_t bodyCount, size_t jointCount = 0) {
+    objects.reserve(bodyCount);
+    bodies.reserve(bodyCount);
+    poolGenerations.reserve(bodyCount);
+    poolFreeSlots.reserve(bodyCount);
+    pairs.reserve(bodyCount * 2);
+    joints.reserve(jointCount);
+    jointStates.reserve(jointCount);
+  }
 };
 
-// Physics manager (Singleton)
+// Counters and timings for one physics step (Physics::SetProfiling)
+struct PhysicsStepStats {
+  int bodies = 0;
+  int awakeBodies = 0;      // Dynamic bodies that are moving or spinning
+  int candidatePairs = 0;   // Broadphase pairs (found once per step)
+  int narrowphaseTests = 0; // Pairs shape-tested, summed over iterations
+  int contacts = 0;         // Tests that found a contact
+  int raycasts = 0;         // Raycast/RaycastAll calls since the last step
+  int solverIterations = 0;
+
+  // Milliseconds
+  float broadphaseTime = 0.0f;
+  float narrowphaseTime = 0.0f;
+  float solveTime = 0.0f;     // Contacts and joints
+  float integrateTime = 0.0f; // Gravity, velocities and positions
+  float totalTime = 0.0f;
+};
+
+// Physics world. Instance() is the default world (Engine::GetPhysics);
+// construct more for previews, paused rooms or hidden simulations. Worlds
+// share no state, so separate worlds may Update() on separate threads as
+// long as they don't share bodies or joints.
 class Physics {
 public:
   static Physics &Instance() {
@@ -247,6 +650,11 @@ public:
     return instance;
   }
 
+  Physics();
+  ~Physics(); // Detaches caller-owned objects and joints, frees pooled bodies
+  Physics(const Physics &) = delete;
+  Physics &operator=(const Physics &) = delete;
+
   // Global physics settings
   void SetGravity(Vector2 newGravity) { gravity = newGravity; }
   Vector2 GetGravity() const { return gravity; }
@@ -257,13 +665,64 @@ public:
   void SetIterations(int newIterations) { iterations = newIterations; }
   int GetIterations() const { return iterations; }
 
-  // Object management
+  // Spiral-of-death guard: Update() runs at most this many fixed steps and
+  // drops the rest of a long frame, so the game slows down instead of
+  // locking up after a hitch
+  void SetMaxStepsPerFrame(int steps) {
+    maxStepsPerFrame = steps > 1 ? steps : 1;
+  }
+  int GetMaxStepsPerFrame() const { return maxStepsPerFrame; }
+
+  // Adaptive sub-stepping: each fixed step is split so no dynamic body
+  // moves more than half its smallest extent per sub-step (up to
+  // maxSubsteps). Keeps fast small bodies from tunnelling; off by default.
+  void SetAdaptiveSubsteps(bool enabled, int limit = 8) {
+    adaptiveSubsteps = enabled;
+    maxSubsteps = limit > 1 ? limit : 1;
+  }
+  bool IsAdaptiveSubstepsEnabled() const { return adaptiveSubsteps; }
+
+  // Last Update(): fixed steps run, most sub-steps in one of them, and
+  // simulated time / real time (1 = real time, < 1 = slow motion because
+  // steps were dropped)
+  int GetLastStepCount() const { return lastStepCount; }
+  int GetLastSubstepCount() const { return lastSubstepCount; }
+  float GetTimeDilation() const { return timeDilation; }
+
+  // Fraction of a fixed step left in the accumulator after Update(), in
+  // [0, 1]. Render helpers blend previous and current transforms by it.
+  float GetInterpolationAlpha() const {
+    return fminf(fmaxf(accumulator / fixedTimeStep, 0.0f), 1.0f);
+  }
+
+  // Object management (caller owns the Object). Pooled bodies can't move to
+  // another world; their storage belongs to the world that created them.
   void AddObject(Object *object);
+  // Reorders GetObjects(). O(1) in a world without joints; otherwise it
+  // also scans GetJoints() for the body's joints.
   void RemoveObject(Object *object);
-  void Clear();
+  void Clear(); // Also destroys every pooled body
+
+  // Pooled bodies (world owns the Object). Storage comes from fixed-size
+  // blocks with a free list, so churning bullets/particles never touches
+  // the general heap once warmed up and pointers stay stable while alive.
+  // Release them with DestroyBody, never delete.
+  BodyHandle CreateBody(const ObjectConfig &config);
+  void DestroyBody(BodyHandle handle);
+  void DestroyBody(Object *object); // Pooled: destroy, otherwise remove
+  Object *GetBody(BodyHandle handle) const; // nullptr if stale
+  BodyHandle GetHandle(const Object *object) const;
+  bool IsValid(BodyHandle handle) const { return GetBody(handle) != nullptr; }
 
   const std::vector<Object *> &GetObjects() const { return objects; }
 
+  // Joints (caller owns the Joint). Velocities are solved before bodies move,
+  // drift is corrected alongside contacts. Removing a body also removes its
+  // joints.
+  void AddJoint(Joint *joint);
+  void RemoveJoint(Joint *joint); // O(1), reorders GetJoints()
+  const std::vector<Joint *> &GetJoints() const { return joints; }
+
   // Physics simulation
   void Update(float deltaTime);
 
@@ -272,31 +731,151 @@ public:
   std::vector<RaycastHit> RaycastAll(Vector2 origin, Vector2 direction,
                                      float maxDistance);
 
-  // Debug rendering
+  // Broadphase query: collects collidable objects whose AABB overlaps area
+  void QueryAABB(Rectangle area, std::vector<Object *> &results) const;
+
+  // Character movement: sweeps object by motion, slides along contacts and
+  // reports floor/wall/ceiling flags. upDirection = {0, 0} treats every
+  // contact as a wall (top-down games). Dynamic bodies hit from the side are
+  // pushed out of the way.
+  MoveResult MoveAndSlide(Object *object, Vector2 motion,
+                          Vector2 upDirection = {0, -1},
+                          float floorMaxAngle = 45.0f);
+
+  // Determinism (lockstep netplay / replays)
+  // Processes collision pairs in body-id order and uses portable trig for
+  // this world's rotations; other worlds are unaffected. Build with
+  // FUMBO_STRICT_FLOAT (default ON) so float contraction can't differ
+  // between compilers.
+  void SetDeterministic(bool enabled);
+  bool IsDeterministic() const { return deterministic; }
+
+  // Snapshots: capture and restore every body's state and the world's body
+  // list without re-creating objects. Restoring also re-adds bodies removed
+  // since the save and drops bodies added after it; the body pool goes back
+  // to its saved slots, so handles from before the save are valid again and
+  // bodies created after it are freed. The joint list comes back the same
+  // way, minus any joint whose bodies aren't in the restored world. Contact
+  // and joint warm starts are saved too. Shape and material aren't, so a
+  // destroyed pooled body whose slot was reused since stays out of the
+  // restored world; its handles fail, like those of the body that reused
+  // the slot.
+  void SaveSnapshot(PhysicsSnapshot &snapshot) const;
+  void RestoreSnapshot(const PhysicsSnapshot &snapshot);
+
+  // Cheap 64-bit hash of every body's transform and velocity. Compare it
+  // between runs or machines after each step to detect desyncs.
+  uint64_t ComputeStateHash() const;
+
+  // Profiling: counters and phase timings for the last PROFILE_HISTORY
+  // steps. Off by default. Timings read the clock at phase boundaries (per
+  // solver iteration for the position passes), never per pair, so they
+  // cost a few dozen clock reads a step.
+  static constexpr int PROFILE_HISTORY = 120;
+  void SetProfiling(bool enabled) { profiling = enabled; }
+  bool IsProfilingEnabled() const { return profiling; }
+  int GetProfileCount() const { return profileCount; }
+  const PhysicsStepStats &GetProfile(int age = 0) const; // 0 = latest step
+  PhysicsStepStats GetAverageProfile() const;
+  // Readout of the averages plus a step time graph, in screen space.
+  // Register it with Engine::AddGlobalOverlay to keep it on top.
+  void DrawProfileOverlay(Vector2 position) const;
+
+  // Camera culling: bodies whose interpolated bounds overlap area, in world
+  // order, triggers and non-collidable bodies included
+  void QueryVisible(Rectangle area, std::vector<Object *> &results) const;
+  // Object::Render for every body the camera can see (call inside
+  // BeginMode2D)
+  void RenderVisible(const Camera2D &camera) const;
+
+  // Debug rendering; the camera overload skips off-screen bodies
   void SetDebugDraw(bool enabled) { debugDraw = enabled; }
   bool IsDebugDrawEnabled() const { return debugDraw; }
   void DrawDebug() const;
+  void DrawDebug(const Camera2D &camera) const;
 
 private:
-  Physics();
-  ~Physics() = default;
-  Physics(const Physics &) = delete;
-  Physics &operator=(const Physics &) = delete;
-
   Vector2 gravity;
   float fixedTimeStep;
   float accumulator;
   int iterations;
+  int maxStepsPerFrame = 5;
+  bool adaptiveSubsteps = false;
+  int maxSubsteps = 8;
+  int lastStepCount = 0;
+  int lastSubstepCount = 0;
+  float timeDilation = 1.0f;
+  float lastSubstepTime = 0.0f; // Scales joint warm starting
   bool debugDraw;
 
+  // Profiling ring buffer; `stepStats` is filled during the current step
+  bool profiling = false;
+  PhysicsStepStats profileHistory[PROFILE_HISTORY];
+  int profileHead = 0; // Next slot to write
+  int profileCount = 0;
+  PhysicsStepStats stepStats;
+  int pendingRaycasts = 0;
+  bool deterministic = false;
+  uint32_t nextBodyId = 1;
+
   std::vector<Object *> objects;
 
+  // Body pool: blocks never move, so pooled Object pointers stay valid
+  static constexpr uint32_t POOL_BLOCK_SIZE = 64;
+  std::vector<std::unique_ptr<Object[]>> poolBlocks;
+  std::vector<uint32_t> poolGenerations; // Odd = live, even = free
+  std::vector<uint32_t> poolFreeSlots;
+  Object *GetPoolObject(uint32_t slot) const {
+    return &poolBlocks[slot / POOL_BLOCK_SIZE][slot % POOL_BLOCK_SIZE];
+  }
+
+  // Broadphase scratch data, reused between steps
+  // Id and body type are copied in so the sweep doesn't chase pointers
+  struct BroadphaseProxy {
+    Rectangle aabb;
+    Object *object;
+    uint32_t id;
+    bool dynamic;
+  };
+  // Previous pass's pairs are only matched by id, never dereferenced, so
+  // bodies removed in between are harmless. The PairState part is carried
+  // over to the next step's matching pair.
+  struct CollisionPair : PairState {
+    Object *objectA = nullptr;
+    Object *objectB = nullptr;
+    float bounceSpeeds[2] = {0.0f, 0.0f}; // Target separating speeds
+  };
+  std::vector<BroadphaseProxy> proxies;
+  std::vector<CollisionPair> pairs;
+  std::vector<CollisionPair> previousPairs;
+  std::vector<CollisionContact> contacts; // Narrowphase results, per pair
+  std::vector<Object *> moveCandidates; // Scratch list for MoveAndSlide
+  mutable std::vector<Object *> visibleObjects; // Scratch for RenderVisible
+
+  std::vector<Joint *> joints;
+  std::vector<uint64_t> jointFilter; // Sorted id pairs that must not collide
+
   // Physics step
+  int ComputeSubsteps(float deltaTime) const;
   void Step(float deltaTime);
   void ApplyGravity(float deltaTime);
-  void ResolveCollisions();
-  void ResolveCollision(Object *objectA, Object *objectB,
-                        const CollisionContact &contact);
+  void FindCollisionPairs(float deltaTime);
+  void TestPairs(); // Narrowphase on every pair, into `contacts`
+  bool IsSolidContact(const CollisionPair &pair,
+                      const CollisionContact &contact) const;
+  void PrepareContacts();
+  void SolveContactVelocities();
+  void SolveContactPositions();
+  void RecordProfile();
+  void DrawDebugObjects(const std::vector<Object *> &list) const;
+  void SolveContactVelocity(CollisionPair &pair,
+                            const CollisionContact &contact);
+  void SolveContactPosition(const CollisionPair &pair,
+                            const CollisionContact &contact);
+  void BuildJointFilter();
+  void WarmStartJoints(float ratio);
+  void SolveJointVelocities(bool reverse);
+  void SolveJointPositions(bool reverse);
 };
 
 } // namespace Graphic2D
@@ -0,0 +1,94 @@
+#pragma once
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Fumbo {
+
+// Sampling class of a pooled target; targets only match their own class
+enum class TargetFormat : uint8_t {
+  Color,    // RGBA8 + depth, point sampled (LoadRenderTexture's default)
+  Filtered, // RGBA8 + depth, bilinear and clamped (blur chains, upscaling)
+};
+
+struct RenderTargetPoolStats {
+  int inUse = 0;
+  int free = 0;
+  size_t inUseBytes = 0; // Estimated VRAM: 4 bytes color + 4 depth per pixel
+  size_t freeBytes = 0;
+  int created = 0; // Totals since startup
+  int reused = 0;
+  int evicted = 0;
+};
+
+// Shared render textures. Acquire() hands out a target of exactly the
+// requested size and format, reusing a released one when it can; Release()
+// gives it back instead of unloading it, so caches that come and go (or
+// get recreated on every resize) recycle the same FBOs. Transient targets
+// are released automatically when Engine::Draw ends. Released targets are
+// unloaded once idle for a while or when the free ones exceed the budget.
+//
+// Contents are undefined after Acquire(); clear before use. Targets from
+// the pool must go back through Release(), never UnloadRenderTexture().
+// Release() takes ownership of any other target and unloads it, so code
+// that swaps a target for a pooled one (Resize, DrawMask, blur chains) never
+// leaks one the caller loaded itself. Main thread only.
+class RenderTargetPool {
+public:
+  static RenderTargetPool &Instance() {
+    static RenderTargetPool instance;
+    return instance;
+  }
+
+  RenderTexture2D Acquire(int width, int height,
+                          TargetFormat format = TargetFormat::Color);
+  // Valid until Release() or the end of the frame, whichever comes first
+  RenderTexture2D AcquireTransient(int width, int height,
+                                   TargetFormat format = TargetFormat::Color);
+  // Returns target to the pool and zeroes it; unloads targets not from it
+  void Release(RenderTexture2D &target);
+
+  // Releases or re-acquires `target` so it matches the size and format;
+  // true if it changed (contents are then undefined)
+  bool Resize(RenderTexture2D &target, int width, int height,
+              TargetFormat format = TargetFormat::Color);
+
+  void EndFrame(); // Engine::Draw: recycles transients, evicts idle targets
+  // Unloads everything, in use or not; targets still held are then dead
+  // and must be dropped rather than released
+  void Clear();
+
+  // Free targets idle this many frames are unloaded (default 120)
+  void SetMaxIdleFrames(int frames) { maxIdleFrames = frames; }
+  // Cap on free targets' memory; oldest go first (default 64 MiB)
+  void SetFreeBudget(size_t bytes) { freeBudget = bytes; }
+  const RenderTargetPoolStats &GetStats() const { return stats; }
+
+private:
+  RenderTargetPool() = default;
+  ~RenderTargetPool() = default;
+  RenderTargetPool(const RenderTargetPool &) = delete;
+  RenderTargetPool &operator=(const RenderTargetPool &) = delete;
+
+  struct Entry {
+    RenderTexture2D target;
+    TargetFormat format;
+    bool inUse;
+    bool transient;
+    uint64_t releasedFrame;
+  };
+
+  std::vector<Entry> entries;
+  uint64_t frame = 0;
+  int maxIdleFrames = 120;
+  size_t freeBudget = 64 * 1024 * 1024;
+  RenderTargetPoolStats stats;
+
+  RenderTexture2D Take(int width, int height, TargetFormat format,
+                       bool transient);
+  void MarkFree(Entry &entry);
+  void Evict(size_t index);
+};
+
+} // namespace Fumbo
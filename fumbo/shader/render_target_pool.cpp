@@ -0,0 +1,166 @@
+#include "../../fumbo.hpp"
+
+namespace Fumbo {
+
+namespace {
+size_t TargetBytes(const RenderTexture2D &target) {
+  // RGBA8 color plus a 24-bit depth renderbuffer, padded to 4 bytes
+  return static_cast<size_t>(target.texture.width) * target.texture.height *
+         8;
+}
+} // namespace
+
+RenderTexture2D RenderTargetPool::Take(int width, int height,
+                                       TargetFormat format, bool transient) {
+  if (width <= 0 || height <= 0) {
+    return RenderTexture2D{0};
+  }
+
+  // Most recently released first, so long-idle targets age out
+  Entry *match = nullptr;
+  for (Entry &entry : entries) {
+    if (!entry.inUse && entry.format == format &&
+        entry.target.texture.width == width &&
+        entry.target.texture.height == height &&
+        (!match || entry.releasedFrame > match->releasedFrame)) {
+      match = &entry;
+    }
+  }
+
+  if (match) {
+    size_t bytes = TargetBytes(match->target);
+    stats.free--;
+    stats.freeBytes -= bytes;
+    stats.reused++;
+  } else {
+    RenderTexture2D target = LoadRenderTexture(width, height);
+    if (target.id == 0) {
+      return target;
+    }
+    if (format == TargetFormat::Filtered) {
+      SetTextureFilter(target.texture, TEXTURE_FILTER_BILINEAR);
+      SetTextureWrap(target.texture, TEXTURE_WRAP_CLAMP);
+    }
+    entries.push_back({target, format, false, false, frame});
+    match = &entries.back();
+    stats.created++;
+  }
+
+  match->inUse = true;
+  match->transient = transient;
+  stats.inUse++;
+  stats.inUseBytes += TargetBytes(match->target);
+  return match->target;
+}
+
+RenderTexture2D RenderTargetPool::Acquire(int width, int height,
+                                          TargetFormat format) {
+  return Take(width, height, format, false);
+}
+
+RenderTexture2D RenderTargetPool::AcquireTransient(int width, int height,
+                                                   TargetFormat format) {
+  return Take(width, height, format, true);
+}
+
+void RenderTargetPool::MarkFree(Entry &entry) {
+  size_t bytes = TargetBytes(entry.target);
+  entry.inUse = false;
+  entry.transient = false;
+  entry.releasedFrame = frame;
+  stats.inUse--;
+  stats.inUseBytes -= bytes;
+  stats.free++;
+  stats.freeBytes += bytes;
+}
+
+void RenderTargetPool::Release(RenderTexture2D &target) {
+  if (target.id == 0) {
+    return;
+  }
+  for (Entry &entry : entries) {
+    if (entry.target.id == target.id) {
+      if (entry.inUse) {
+        MarkFree(entry);
+      }
+      target = RenderTexture2D{0};
+      return;
+    }
+  }
+
+  // Not ours (e.g. from LoadRenderTexture): the caller is done with it, and
+  // only unloading keeps it from leaking
+  UnloadRenderTexture(target);
+  target = RenderTexture2D{0};
+}
+
+bool RenderTargetPool::Resize(RenderTexture2D &target, int width, int height,
+                              TargetFormat format) {
+  if (target.id != 0 && target.texture.width == width &&
+      target.texture.height == height) {
+    for (const Entry &entry : entries) {
+      if (entry.target.id == target.id && entry.format == format) {
+        return false;
+      }
+    }
+  }
+  Release(target);
+  target = Acquire(width, height, format);
+  return true;
+}
+
+void RenderTargetPool::Evict(size_t index) {
+  Entry &entry = entries[index];
+  size_t bytes = TargetBytes(entry.target);
+  if (entry.inUse) {
+    stats.inUse--;
+    stats.inUseBytes -= bytes;
+  } else {
+    stats.free--;
+    stats.freeBytes -= bytes;
+  }
+  UnloadRenderTexture(entry.target);
+  entries.erase(entries.begin() + index);
+  stats.evicted++;
+}
+
+void RenderTargetPool::EndFrame() {
+  for (Entry &entry : entries) {
+    if (entry.inUse && entry.transient) {
+      MarkFree(entry);
+    }
+  }
+
+  // A resize storm releases a new size every frame; the idle limit lets a
+  // size that comes back be reused, the budget keeps the backlog bounded
+  for (size_t i = entries.size(); i-- > 0;) {
+    if (!entries[i].inUse &&
+        frame - entries[i].releasedFrame >= (uint64_t)maxIdleFrames) {
+      Evict(i);
+    }
+  }
+  while (stats.freeBytes > freeBudget) {
+    size_t oldest = entries.size();
+    for (size_t i = 0; i < entries.size(); i++) {
+      if (!entries[i].inUse &&
+          (oldest == entries.size() ||
+           entries[i].releasedFrame < entries[oldest].releasedFrame)) {
+        oldest = i;
+      }
+    }
+    if (oldest == entries.size()) {
+      break;
+    }
+    Evict(oldest);
+  }
+
+  frame++;
+}
+
+void RenderTargetPool::Clear() {
+  for (size_t i = entries.size(); i-- > 0;) {
+    Evict(i);
+  }
+}
+
+} // namespace Fumbo
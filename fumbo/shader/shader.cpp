@@ -223,16 +223,15 @@ Texture2D DrawMask(RenderTexture2D screen, RenderTexture2D &renderTarget,
                        renderTarget.texture.height != screenHeight;
 
   if (needsRecreate) {
-    // Cleanup old resources
-    if (renderTarget.id != 0) {
-      UnloadRenderTexture(renderTarget);
-    }
+    // Cleanup old resources; the target goes back to the pool
+    RenderTargetPool &pool = RenderTargetPool::Instance();
+    pool.Release(renderTarget);
     if (maskShader.id != 0) {
       UnloadShader(maskShader);
     }
 
     // Create new resources
-    renderTarget = LoadRenderTexture(screenWidth, screenHeight);
+    renderTarget = pool.Acquire(screenWidth, screenHeight);
     maskShader = MakeSolidColorShader(maskColor);
   }
 
@@ -266,16 +265,15 @@ Texture2D ApplyRadialBlur(Texture2D source, RenderTexture2D &canvas,
   static unsigned int cachedShaderId = 0;
 
   if (needsRecreate) {
-    // Cleanup old resources
-    if (canvas.id != 0) {
-      UnloadRenderTexture(canvas);
-    }
+    // Cleanup old resources; the canvas goes back to the pool
+    RenderTargetPool &pool = RenderTargetPool::Instance();
+    pool.Release(canvas);
     if (shader.id != 0) {
       UnloadShader(shader);
     }
 
     // Create new resources
-    canvas = LoadRenderTexture(source.width, source.height);
+    canvas = pool.Acquire(source.width, source.height);
     shader = LoadShaderFromMemory(NULL, radialBlurShader);
 
     // Cache shader uniform locations for new shader
@@ -1,4 +1,6 @@
 #include "../../fumbo.hpp"
+#include "rlgl.h"
+#include <cmath>
 
 namespace Fumbo {
 
@@ -48,6 +50,39 @@ void main()
     gl_FragColor = (sum / float(count)) * fragColor;
 }
 )";
+
+// Separable Gaussian pass. Taps come folded in pairs: offsets[i] sits
+// between two texels so one bilinear fetch returns both, weighted.
+const char* gaussianShaderCode = R"(
+#version 100
+precision mediump float;
+
+varying vec2 fragTexCoord;
+varying vec4 fragColor;
+
+uniform sampler2D texture0;
+
+uniform vec2 texelStep;
+uniform float weights[16];
+uniform float offsets[16];
+uniform int tapCount;
+
+void main()
+{
+    const int MAX_TAPS = 16;
+    vec4 sum = texture2D(texture0, fragTexCoord) * weights[0];
+
+    for (int i = 1; i < MAX_TAPS; ++i)
+    {
+        if (i >= tapCount) break;
+        vec2 offset = texelStep * offsets[i];
+        sum += (texture2D(texture0, fragTexCoord + offset) +
+                texture2D(texture0, fragTexCoord - offset)) * weights[i];
+    }
+
+    gl_FragColor = sum * fragColor;
+}
+)";
 #else
 const char* blurShaderCode = R"(
 #version 330
@@ -88,20 +123,93 @@ void main()
     finalColor = (sum / float(count)) * fragColor;
 }
 )";
+
+// Separable Gaussian pass. Taps come folded in pairs: offsets[i] sits
+// between two texels so one bilinear fetch returns both, weighted.
+const char* gaussianShaderCode = R"(
+#version 330
+
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+uniform sampler2D texture0;
+
+out vec4 finalColor;
+
+uniform vec2 texelStep;
+uniform float weights[16];
+uniform float offsets[16];
+uniform int tapCount;
+
+void main()
+{
+    vec4 sum = texture(texture0, fragTexCoord) * weights[0];
+
+    for (int i = 1; i < tapCount; ++i)
+    {
+        vec2 offset = texelStep * offsets[i];
+        sum += (texture(texture0, fragTexCoord + offset) +
+                texture(texture0, fragTexCoord - offset)) * weights[i];
+    }
+
+    finalColor = sum * fragColor;
+}
+)";
 #endif
 
+namespace {
+constexpr int MAX_GAUSSIAN_TAPS = 16; // Array size in gaussianShaderCode
+
+// Paired taps and the upsample need bilinear filtering; clamping keeps the
+// opposite edge from bleeding in. The pool recycles the old size.
+void EnsureBlurTarget(RenderTexture2D& target, int width, int height) {
+  RenderTargetPool::Instance().Resize(target, width, height, TargetFormat::Filtered);
+}
+
+// Stretches source over target, replacing its pixels instead of blending
+void BlitTo(RenderTexture2D& target, Texture2D source, bool sourceFlipped) {
+  BeginTextureMode(target);
+  rlSetBlendFactors(RL_ONE, RL_ZERO, RL_FUNC_ADD);
+  BeginBlendMode(BLEND_CUSTOM);
+  Rectangle src = {0, 0, (float)source.width,
+                   sourceFlipped ? -(float)source.height : (float)source.height};
+  Rectangle dst = {0, 0, (float)target.texture.width, (float)target.texture.height};
+  ::DrawTexturePro(source, src, dst, Vector2{0, 0}, 0.0f, WHITE);
+  EndBlendMode();
+  EndTextureMode();
+}
+
+void UnloadBlurTarget(RenderTexture2D& target) {
+  RenderTargetPool::Instance().Release(target);
+}
+}  // namespace
+
 void ShaderManager::Init(int width, int height) {
   blurShader = LoadShaderFromMemory(nullptr, blurShaderCode);
   locRenderWidth = GetShaderLocation(blurShader, "renderWidth");
   locRenderHeight = GetShaderLocation(blurShader, "renderHeight");
   locRadius = GetShaderLocation(blurShader, "radius");
 
-  blurTarget = LoadRenderTexture(width, height);
+  gaussianShader = LoadShaderFromMemory(nullptr, gaussianShaderCode);
+  locTexelStep = GetShaderLocation(gaussianShader, "texelStep");
+  locWeights = GetShaderLocation(gaussianShader, "weights");
+  locOffsets = GetShaderLocation(gaussianShader, "offsets");
+  locTapCount = GetShaderLocation(gaussianShader, "tapCount");
+
+  // Downsampled bilinearly, so each 1/2 level averages 2x2 texels
+  EnsureBlurTarget(blurTarget, width, height);
 }
 
 void ShaderManager::Cleanup() {
   UnloadShader(blurShader);
-  UnloadRenderTexture(blurTarget);
+  UnloadShader(gaussianShader);
+  UnloadBlurTarget(blurTarget);
+  for (int level = 0; level < BLUR_LEVELS; level++) {
+    UnloadBlurTarget(blurLevels[level]);
+    UnloadBlurTarget(blurScratch[level]);
+  }
+  UnloadBlurTarget(blurSnapshot);
+  snapshotValid = false;
 }
 
 void ShaderManager::BeginBlurMode(float radius) {
@@ -118,6 +226,8 @@ void ShaderManager::BeginBlurMode(float radius) {
 void ShaderManager::EndBlurMode() { EndShaderMode(); }
 
 void ShaderManager::BeginBlurPass() {
+  // Follow window resizes so the pass covers the whole screen
+  EnsureBlurTarget(blurTarget, GetScreenWidth(), GetScreenHeight());
   BeginTextureMode(blurTarget);
   ClearBackground(BLANK);  // Ensure transparency
   blurPassActive = true;
@@ -129,20 +239,147 @@ void ShaderManager::EndBlurPass(float radius, Vector2 pos) {
   EndTextureMode();
   blurPassActive = false;
 
-  // Draw the result with blur
-  BeginBlurMode(radius);
-  // DrawTextureRec renders a part of texture defined by rec.
-  // We need to flip Y because OpenGL coordinates for RenderTextures are inverted relative to Raylib
-  // drawing.
-  Rectangle src = {0, 0, (float)blurTarget.texture.width, -(float)blurTarget.texture.height};
-  DrawTextureRec(blurTarget.texture, src, pos, WHITE);
-  EndBlurMode();
+  // RenderTextures are stored flipped relative to Raylib drawing
+  DrawBlurred(blurTarget.texture, true, pos, radius);
 }
 
 void ShaderManager::DrawBlur(Texture2D texture, Vector2 pos, float radius) {
-  BeginBlurMode(radius);
-  DrawTextureV(texture, pos, WHITE);
-  EndBlurMode();
+  DrawBlurred(texture, false, pos, radius);
+}
+
+void ShaderManager::DrawBlurred(Texture2D source, bool sourceFlipped, Vector2 pos, float radius) {
+  Rectangle src = {0, 0, (float)source.width,
+                   sourceFlipped ? -(float)source.height : (float)source.height};
+
+  // Up to radius 2 the box shader is at most 25 taps; the chain costs more
+  if (radius < 3.0f) {
+    BeginBlurMode(radius);
+    DrawTextureRec(source, src, pos, WHITE);
+    EndBlurMode();
+    return;
+  }
+
+  // Upsample: bilinear stretch of the blurred level back to full size
+  const RenderTexture2D& result = GaussianBlur(source, sourceFlipped, radius);
+  Rectangle blurredSrc = {0, 0, (float)result.texture.width, -(float)result.texture.height};
+  Rectangle dst = {pos.x, pos.y, (float)source.width, (float)source.height};
+  ::DrawTexturePro(result.texture, blurredSrc, dst, Vector2{0, 0}, 0.0f, WHITE);
+}
+
+// Snapshot
+
+bool ShaderManager::NeedsBlurredSnapshot(float radius) const {
+  return NeedsBlurredSnapshot(blurTarget.texture, radius);
+}
+
+bool ShaderManager::NeedsBlurredSnapshot(Texture2D source, float radius) const {
+  return !snapshotValid || source.id != snapshotSourceId || radius != snapshotRadius ||
+         GetScreenWidth() != snapshotScreenWidth || GetScreenHeight() != snapshotScreenHeight;
+}
+
+void ShaderManager::CaptureBlurredSnapshot(float radius) {
+  if (!blurPassActive) return;
+
+  EndTextureMode();
+  blurPassActive = false;
+  CaptureBlurredSnapshot(blurTarget.texture, radius);
+}
+
+void ShaderManager::CaptureBlurredSnapshot(Texture2D source, float radius) {
+  // The blur pass target is stored flipped; any other source is upright
+  bool sourceFlipped = source.id == blurTarget.texture.id;
+  EnsureBlurTarget(blurSnapshot, source.width, source.height);
+
+  if (radius < 3.0f) {
+    BeginBlurMode(radius);
+    BlitTo(blurSnapshot, source, sourceFlipped);
+    EndBlurMode();
+  } else {
+    // Full size, so drawing it is a plain 1:1 quad
+    const RenderTexture2D& result = GaussianBlur(source, sourceFlipped, radius);
+    BlitTo(blurSnapshot, result.texture, true);
+  }
+
+  snapshotValid = true;
+  snapshotRadius = radius;
+  snapshotSourceId = source.id;
+  snapshotScreenWidth = GetScreenWidth();
+  snapshotScreenHeight = GetScreenHeight();
+}
+
+void ShaderManager::DrawBlurredSnapshot(Vector2 pos, Color tint) {
+  if (blurSnapshot.id == 0) return;
+
+  Rectangle src = {0, 0, (float)blurSnapshot.texture.width, -(float)blurSnapshot.texture.height};
+  DrawTextureRec(blurSnapshot.texture, src, pos, tint);
+}
+
+const RenderTexture2D& ShaderManager::GaussianBlur(Texture2D source, bool sourceFlipped,
+                                                   float radius) {
+  // Same spread as the (2r+1)^2 box blur: variance r(r+1)/3
+  float variance = radius * (radius + 1.0f) / 3.0f;
+  int levels = variance >= 36.0f ? 2 : 1;
+  int scale = 1 << levels;
+
+  // The 2x2 averages (1/4 texel^2 per level, at that level's spacing) and
+  // the bilinear upsample (scale^2 / 6) blur too; the Gaussian adds the rest
+  float chainVariance = (levels == 2 ? 1.25f : 0.25f) + scale * scale / 6.0f;
+  float levelVariance = (variance - chainVariance) / (scale * scale);
+  float sigma = sqrtf(fmaxf(levelVariance, 0.25f));
+
+  // Mip chain down to the working level
+  int width = source.width;
+  int height = source.height;
+  Texture2D input = source;
+  bool inputFlipped = sourceFlipped;
+  for (int level = 0; level < levels; level++) {
+    width = (width + 1) / 2;
+    height = (height + 1) / 2;
+    EnsureBlurTarget(blurLevels[level], width, height);
+    BlitTo(blurLevels[level], input, inputFlipped);
+    input = blurLevels[level].texture;
+    inputFlipped = true;
+  }
+  RenderTexture2D& target = blurLevels[levels - 1];
+  RenderTexture2D& scratch = blurScratch[levels - 1];
+  EnsureBlurTarget(scratch, width, height);
+
+  // Discrete kernel to 3 sigma, capped at what the shader holds
+  int halfWidth = (int)ceilf(3.0f * sigma);
+  if (halfWidth > 2 * (MAX_GAUSSIAN_TAPS - 1)) halfWidth = 2 * (MAX_GAUSSIAN_TAPS - 1);
+  float kernel[2 * MAX_GAUSSIAN_TAPS] = {0};
+  float total = 0.0f;
+  for (int i = 0; i <= halfWidth; i++) {
+    kernel[i] = expf(-(float)(i * i) / (2.0f * sigma * sigma));
+    total += i == 0 ? kernel[i] : 2.0f * kernel[i];
+  }
+
+  // Fold texel pairs (1,2), (3,4)... into single bilinear taps
+  float weights[MAX_GAUSSIAN_TAPS] = {kernel[0] / total};
+  float offsets[MAX_GAUSSIAN_TAPS] = {0.0f};
+  int taps = 1;
+  for (int i = 1; i <= halfWidth; i += 2) {
+    float pairWeight = kernel[i] + kernel[i + 1];
+    weights[taps] = pairWeight / total;
+    offsets[taps] = (i * kernel[i] + (i + 1) * kernel[i + 1]) / pairWeight;
+    taps++;
+  }
+
+  SetShaderValueV(gaussianShader, locWeights, weights, SHADER_UNIFORM_FLOAT, taps);
+  SetShaderValueV(gaussianShader, locOffsets, offsets, SHADER_UNIFORM_FLOAT, taps);
+  SetShaderValue(gaussianShader, locTapCount, &taps, SHADER_UNIFORM_INT);
+
+  // Horizontal into the scratch target, vertical back into the level
+  BeginShaderMode(gaussianShader);
+  Vector2 step = {1.0f / width, 0.0f};
+  SetShaderValue(gaussianShader, locTexelStep, &step, SHADER_UNIFORM_VEC2);
+  BlitTo(scratch, target.texture, true);
+  step = {0.0f, 1.0f / height};
+  SetShaderValue(gaussianShader, locTexelStep, &step, SHADER_UNIFORM_VEC2);
+  BlitTo(target, scratch.texture, true);
+  EndShaderMode();
+
+  return target;
 }
 
 }  // namespace Fumbo
@@ -0,0 +1,75 @@
+#pragma once
+#include "physics.hpp"
+#include "raylib.h"
+#include <cstdint>
+#include <vector>
+
+namespace Fumbo {
+namespace Graphic2D {
+
+// Counters for the last SpriteBatch::End()
+struct SpriteBatchStats {
+  int sprites = 0;
+  int batches = 0; // Texture runs submitted (raylib draw calls, before any
+                   // vertex-buffer overflow splits)
+  int layers = 0;
+};
+
+// Sorted, texture-batched sprite renderer. Draw() records sprite instances
+// in the same UI/world space as the Graphic2D wrappers; End() radix-sorts
+// them by layer, then texture, and submits each texture run as one rlgl
+// quad batch. Lower layers draw first; within a layer, sprites sharing a
+// texture keep submission order but different textures may reorder, so put
+// overlapping sprites that must stack on separate layers.
+class SpriteBatch {
+public:
+  void Begin(); // Drops anything recorded since the last End()
+  void End();   // Sorts, submits and records stats
+
+  void Draw(Texture2D texture, Rectangle source, Rectangle dest,
+            Vector2 origin = {0, 0}, float rotation = 0.0f,
+            Color tint = WHITE, int layer = 0);
+
+  // Same placement as Utils::DrawWorldSprite / DrawWorldSpriteAt
+  void DrawWorldSprite(const Object *object, Texture2D texture,
+                       Rectangle source, Vector2 offset = {0, 0},
+                       float scale = 1.0f, Color tint = WHITE, int layer = 0);
+  void DrawWorldSpriteAt(Rectangle worldRect, Texture2D texture,
+                         Rectangle source, Color tint = WHITE, int layer = 0);
+
+  // Queues a rectangle object the way Object::Render draws it (textured or
+  // filled). Returns false for shapes it can't batch (circles, polygons,
+  // lines, outlines); Render() those instead.
+  bool DrawObject(const Object *object, int layer = 0);
+
+  void Reserve(size_t spriteCount);
+  int GetSpriteCount() const { return (int)sprites.size(); }
+  const SpriteBatchStats &GetStats() const { return stats; }
+
+private:
+  struct Sprite {
+    unsigned int textureId;
+    int textureWidth;
+    int textureHeight;
+    Rectangle source;
+    Rectangle dest;
+    Vector2 origin;
+    float rotation;
+    Color tint;
+  };
+
+  std::vector<Sprite> sprites;
+  std::vector<uint64_t> keys; // Layer (high 32 bits), texture id (low 32)
+  SpriteBatchStats stats;
+
+  // Radix sort scratch, reused between frames
+  std::vector<uint32_t> order;
+  std::vector<uint32_t> orderScratch;
+  std::vector<uint64_t> keyScratch;
+
+  void Push(const Sprite &sprite, int layer);
+  void SortByKey();
+};
+
+} // namespace Graphic2D
+} // namespace Fumbo
@@ -0,0 +1,100 @@
+#pragma once
+#include "raylib.h"
+#include <cstdint>
+#include <vector>
+
+namespace Fumbo {
+namespace Graphic2D {
+
+// Counters for the last TileMap::Update/Draw
+struct TileMapStats {
+  int visibleChunks = 0;  // Non-empty chunks overlapping the camera
+  int drawCalls = 0;      // Cached chunk draws, plus one per fallback chunk
+  int residentChunks = 0; // Chunks holding a render target
+  int rebuiltChunks = 0;  // Render targets redrawn in the last Update
+};
+
+// Chunked tile layer. Tile indices live in one compact array; every
+// CHUNK_SIZE x CHUNK_SIZE block is cached in its own render target, redrawn
+// only when one of its tiles changes, and drawn with a single call. Chunks
+// near the camera are streamed in by Update() and released once they drift
+// out of range, so huge maps only hold a screenful of targets.
+//
+// Index 0 is empty; index n draws tile n - 1 of the tileset atlas (row-major,
+// tilePixels square). Positions are world units, `tileSize` per tile, with
+// the map's top-left corner at `origin`.
+class TileMap {
+public:
+  static constexpr int CHUNK_SIZE = 32; // Tiles per chunk side
+  static constexpr uint16_t EMPTY = 0;
+
+  TileMap() = default;
+  ~TileMap(); // Unload()
+  TileMap(const TileMap &) = delete;
+  TileMap &operator=(const TileMap &) = delete;
+
+  void Create(int width, int height, float tileSize, Texture2D tileset,
+              int tilePixels, Vector2 origin = {0, 0});
+  void Unload(); // Returns every chunk render target to RenderTargetPool
+
+  void SetTile(int x, int y, uint16_t tile);
+  uint16_t GetTile(int x, int y) const; // EMPTY outside the map
+  void Fill(uint16_t tile);
+
+  // Streams chunk targets in around the camera (view plus `streamMargin`
+  // chunks) and rebuilds at most `maxRebuildsPerFrame` stale ones. Renders
+  // to textures, so call it outside BeginTextureMode/BeginMode2D.
+  void Update(const Camera2D &camera);
+  // Draws the chunks the camera can see, inside BeginMode2D. Chunks whose
+  // target isn't ready yet draw tile by tile for that frame.
+  void Draw(const Camera2D &camera);
+
+  void SetStreamMargin(int chunks) { streamMargin = chunks > 0 ? chunks : 0; }
+  void SetMaxRebuildsPerFrame(int count) {
+    maxRebuildsPerFrame = count > 1 ? count : 1;
+  }
+
+  int GetWidth() const { return width; }
+  int GetHeight() const { return height; }
+  float GetTileSize() const { return tileSize; }
+  Rectangle GetTileRect(int x, int y) const;
+  const TileMapStats &GetStats() const { return stats; }
+
+private:
+  struct Chunk {
+    RenderTexture2D target = {0};
+    bool dirty = true;   // Tiles changed since the target was drawn
+    int tileCount = 0;   // Non-empty tiles; empty chunks get no target
+    bool resident = false;
+  };
+
+  int width = 0;
+  int height = 0;
+  float tileSize = 32.0f;
+  Vector2 origin = {0, 0};
+  Texture2D tileset = {0};
+  int tilePixels = 16;
+  int tilesetColumns = 1;
+
+  std::vector<uint16_t> tiles; // Row-major, width * height
+  int chunksX = 0;
+  int chunksY = 0;
+  std::vector<Chunk> chunks;
+  std::vector<int> residentList; // Indices of resident chunks
+
+  int streamMargin = 1;
+  int maxRebuildsPerFrame = 4;
+  TileMapStats stats;
+
+  Rectangle GetChunkRect(int chunkX, int chunkY) const;
+  // Chunk range overlapping `area`, grown by `margin` chunks; false if empty
+  bool GetChunkRange(Rectangle area, int margin, int &minX, int &minY,
+                     int &maxX, int &maxY) const;
+  Rectangle GetTileSource(uint16_t tile) const;
+  void BuildChunk(int chunkX, int chunkY);
+  void ReleaseChunk(int index);
+  void DrawChunkTiles(int chunkX, int chunkY, Rectangle view) const;
+};
+
+} // namespace Graphic2D
+} // namespace Fumbo
@@ -4,8 +4,7 @@
 using namespace Fumbo::UI;
 
 Button::~Button() {
-  if (m_cacheTexture.id != 0)
-    UnloadRenderTexture(m_cacheTexture);
+  Fumbo::RenderTargetPool::Instance().Release(m_cacheTexture);
 }
 
 Button::Button(Button &&other) noexcept { *this = std::move(other); }
@@ -13,8 +12,7 @@ Button::Button(Button &&other) noexcept { *this = std::move(other); }
 Button &Button::operator=(Button &&other) noexcept {
   if (this != &other) {
     // Cleanup current
-    if (m_cacheTexture.id != 0)
-      UnloadRenderTexture(m_cacheTexture);
+    Fumbo::RenderTargetPool::Instance().Release(m_cacheTexture);
 
     // Move data
     uiBounds = other.uiBounds;
@@ -167,7 +165,7 @@ void Button::Draw() {
     screenBounds = uiBounds;
   } else {
     screenBounds = Fumbo::Utils::UISpaceToScreen(uiBounds);
-    Vector2 uiOffset = Fumbo::Utils::GetUIOffset();
+    Vector2 uiOffset = Fumbo::Utils::GetUITransform().offset;
     screenBounds.x += uiOffset.x;
     screenBounds.y += uiOffset.y;
   }
@@ -178,10 +176,11 @@ void Button::Draw() {
   // 1. Check if Cache needs resize or init
   if (m_cacheTexture.id == 0 || width != m_lastWidth ||
       height != m_lastHeight) {
-    if (m_cacheTexture.id != 0)
-      UnloadRenderTexture(m_cacheTexture);
+    // Pooled, so same-sized buttons and resizes recycle targets
+    Fumbo::RenderTargetPool &pool = Fumbo::RenderTargetPool::Instance();
+    pool.Release(m_cacheTexture);
     if (width > 0 && height > 0) {
-      m_cacheTexture = LoadRenderTexture(width, height);
+      m_cacheTexture = pool.Acquire(width, height);
       m_lastWidth = width;
       m_lastHeight = height;
       m_isDirty = true;
@@ -210,7 +209,7 @@ void Button::Draw() {
 
     // Draw text
     if (!text.empty()) {
-      Vector2 scale = Fumbo::Utils::GetUIScale();
+      Vector2 scale = Fumbo::Utils::GetUITransform().scale;
       float fontSize = baseFontSize * scale.y;
 
       float xPadding = 10.0f * scale.x;
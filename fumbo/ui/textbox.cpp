@@ -351,7 +351,7 @@ void Textbox::Draw() {
 
   Vector2 scale = {1.0f, 1.0f};
   if (!m_worldSpace) {
-      scale = Fumbo::Utils::GetUIScale();
+      scale = Fumbo::Utils::GetUITransform().scale;
   }
 
   // 1. Draw Background
@@ -389,7 +389,7 @@ void Textbox::Draw() {
       screenBounds.height - (m_config.padding.y * scale.y * 2)
   };
 
-  BeginScissorMode((int)textArea.x, (int)textArea.y, (int)textArea.width, (int)textArea.height);
+  Fumbo::Utils::PushScissor(textArea);
 
   Vector2 textPos = {textArea.x, textArea.y};
   float scaledFontSize = m_fontSize * scale.y;
@@ -492,7 +492,7 @@ void Textbox::Draw() {
     DrawLineEx(cursorPos, {cursorPos.x, cursorPos.y + scaledFontSize}, 2.0f * scale.y, m_config.cursorColor);
   }
 
-  EndScissorMode();
+  Fumbo::Utils::PopScissor();
 }
 
 } // namespace UI
@@ -252,18 +252,20 @@ namespace Fumbo {
       Vector2 pen = startPos;
       int charsProcessed = 0;
 
+      // Cut lines live in frame scratch memory, not a substr per line
+      Fumbo::Utils::FrameAllocator::Scope scratch;
       for (const std::string& line : m_wrappedLines) {
         if (charsProcessed >= m_visibleChars) break;
 
-        std::string lineToDraw = line;
+        const char* lineToDraw = line.c_str();
 
         // Check if we need to cut the line
         int charsNeeded = m_visibleChars - charsProcessed;
         if (charsNeeded < (int)line.length()) {
-          lineToDraw = line.substr(0, charsNeeded);
+          lineToDraw = Fumbo::Utils::FrameAllocator::Instance().CopyString(line.c_str(), charsNeeded);
         }
 
-        DrawTextEx(font, lineToDraw.c_str(), pen, fontSize, spacing, color);
+        DrawTextEx(font, lineToDraw, pen, fontSize, spacing, color);
 
         pen.y += fontSize + spacing;      // Next line
         charsProcessed += line.length();  // Count logic is approx if tags existed
@@ -414,21 +416,22 @@ namespace Fumbo {
       int charsProcessed = 0;
       float lineHeight = fontSize * m_textStyle.lineHeightMultiplier;
       
+      Fumbo::Utils::FrameAllocator::Scope scratch;
       for (const std::string& line : m_wrappedLines) {
         if (charsProcessed >= m_visibleChars) break;
         
-        std::string lineToDraw = line;
+        const char* lineToDraw = line.c_str();
         int charsNeeded = m_visibleChars - charsProcessed;
         if (charsNeeded < (int)line.length()) {
-          lineToDraw = line.substr(0, charsNeeded);
+          lineToDraw = Fumbo::Utils::FrameAllocator::Instance().CopyString(line.c_str(), charsNeeded);
         }
         
         float xOffset = 0.0f;
         if (m_textStyle.alignment == TextAlign::CENTER) {
-          Vector2 textSize = MeasureTextEx(font, lineToDraw.c_str(), fontSize, spacing);
+          Vector2 textSize = MeasureTextEx(font, lineToDraw, fontSize, spacing);
           xOffset = (textAreaWidth - textSize.x) / 2.0f;
         } else if (m_textStyle.alignment == TextAlign::RIGHT) {
-          Vector2 textSize = MeasureTextEx(font, lineToDraw.c_str(), fontSize, spacing);
+          Vector2 textSize = MeasureTextEx(font, lineToDraw, fontSize, spacing);
           xOffset = textAreaWidth - textSize.x;
         }
         
@@ -0,0 +1,130 @@
+#include "../../fumbo.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#ifdef FUMBO_COUNT_HEAP_ALLOCS
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Every operator new in the process, for the steady-state frame check
+static std::atomic<long> heapAllocationCount{0};
+
+void *operator new(std::size_t size) {
+  heapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  if (void *memory = std::malloc(size ? size : 1))
+    return memory;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+void operator delete(void *memory, std::size_t) noexcept { std::free(memory); }
+#endif
+
+namespace Fumbo {
+namespace Utils {
+
+namespace {
+constexpr size_t INITIAL_BLOCK_SIZE = 64 * 1024;
+} // namespace
+
+long GetHeapAllocationCount() {
+#ifdef FUMBO_COUNT_HEAP_ALLOCS
+  return heapAllocationCount.load(std::memory_order_relaxed);
+#else
+  return -1;
+#endif
+}
+
+void FrameAllocator::AddBlock(size_t minimumSize) {
+  size_t size = std::max(minimumSize, INITIAL_BLOCK_SIZE);
+  if (!blocks.empty()) {
+    size = std::max(size, blocks.back().size * 2);
+  }
+  blocks.push_back({std::unique_ptr<uint8_t[]>(new uint8_t[size]), size});
+  stats.capacity += size;
+  stats.blockAllocations++;
+}
+
+void *FrameAllocator::Allocate(size_t bytes, size_t alignment) {
+  if (blocks.empty()) {
+    AddBlock(bytes + alignment);
+  }
+
+  while (true) {
+    Block &block = blocks[currentBlock];
+    uintptr_t base = (uintptr_t)block.data.get();
+    size_t aligned =
+        ((base + currentOffset + alignment - 1) & ~(uintptr_t)(alignment - 1)) -
+        base;
+    if (aligned + bytes <= block.size) {
+      currentOffset = aligned + bytes;
+      stats.used = usedInEarlierBlocks + currentOffset;
+      stats.peak = std::max(stats.peak, stats.used);
+      return block.data.get() + aligned;
+    }
+
+    // Overflow: chain the next block; BeginFrame() merges them
+    usedInEarlierBlocks += currentOffset;
+    if (currentBlock + 1 == blocks.size()) {
+      AddBlock(bytes + alignment);
+    }
+    currentBlock++;
+    currentOffset = 0;
+  }
+}
+
+const char *FrameAllocator::CopyString(const char *text, size_t length) {
+  char *copy = AllocateArray<char>(length + 1);
+  std::memcpy(copy, text, length);
+  copy[length] = '\0';
+  return copy;
+}
+
+FrameAllocator::Scope::Scope() {
+  FrameAllocator &allocator = FrameAllocator::Instance();
+  block = allocator.currentBlock;
+  offset = allocator.currentOffset;
+  usedBefore = allocator.usedInEarlierBlocks;
+}
+
+FrameAllocator::Scope::~Scope() {
+  FrameAllocator &allocator = FrameAllocator::Instance();
+  allocator.currentBlock = block;
+  allocator.currentOffset = offset;
+  allocator.usedInEarlierBlocks = usedBefore;
+  allocator.stats.used = usedBefore + offset;
+}
+
+void FrameAllocator::BeginFrame() {
+  // Last frame overflowed: one block big enough for all of it
+  if (blocks.size() > 1) {
+    size_t total = stats.capacity;
+    blocks.clear();
+    stats.capacity = 0;
+    AddBlock(total);
+  }
+  currentBlock = 0;
+  currentOffset = 0;
+  usedInEarlierBlocks = 0;
+  stats.used = 0;
+
+#ifdef FUMBO_COUNT_HEAP_ALLOCS
+  heapAtFrameStart = GetHeapAllocationCount();
+#endif
+}
+
+void FrameAllocator::EndFrame() {
+#ifdef FUMBO_COUNT_HEAP_ALLOCS
+  stats.heapAllocations = GetHeapAllocationCount() - heapAtFrameStart;
+  if (expectNoHeap && stats.heapAllocations > 0) {
+    TraceLog(LOG_WARNING, "FRAME: %ld heap allocations while drawing",
+             stats.heapAllocations);
+    assert(stats.heapAllocations == 0 && "Heap allocation in a steady frame");
+  }
+#endif
+}
+
+} // namespace Utils
+} // namespace Fumbo
@@ -3,6 +3,7 @@
 #include "raymath.h"
 #include <algorithm> // For std::clamp
 #include <cmath>
+#include <vector>
 
 namespace Fumbo {
 namespace Utils {
@@ -18,6 +19,27 @@ Vector2 GetUIOffset() {
   return {(sw - UI_WIDTH * sc) * 0.5f, (sh - UI_HEIGHT * sc) * 0.5f};
 }
 
+UITransform frameUITransform;
+
+namespace {
+// World culling state (BeginWorldCulling)
+bool worldCulling = false;
+Rectangle worldCullRect = {0, 0, 0, 0};
+
+// Scissor stack (PushScissor); keeps its capacity between frames
+std::vector<Rectangle> scissorStack;
+
+void ApplyScissor(Rectangle rect) {
+  BeginScissorMode((int)rect.x, (int)rect.y, (int)rect.width,
+                   (int)rect.height);
+}
+} // namespace
+
+void UpdateUITransform() {
+  frameUITransform.scale = GetUIScale();
+  frameUITransform.offset = GetUIOffset();
+}
+
 Vector2 CenterPosX(Vector2 objsize) {
   float screenWidth = UI_WIDTH; // Logic space center
   objsize.x = (screenWidth - objsize.x) * 0.5f;
@@ -39,6 +61,26 @@ Rectangle UISpaceToScreen(Rectangle ui) {
   return {ui.x * s.x, ui.y * s.y, ui.width * s.x, ui.height * s.y};
 }
 
+void PushScissor(Rectangle screenRect) {
+  if (!scissorStack.empty()) {
+    // Zero-sized when they don't overlap, which clips everything
+    screenRect = GetCollisionRec(screenRect, scissorStack.back());
+  }
+  scissorStack.push_back(screenRect);
+  ApplyScissor(screenRect);
+}
+
+void PopScissor() {
+  if (scissorStack.empty())
+    return;
+  scissorStack.pop_back();
+  if (scissorStack.empty()) {
+    EndScissorMode();
+  } else {
+    ApplyScissor(scissorStack.back());
+  }
+}
+
 void DrawPixelRuler(int spacing, Font font) {
   int sw = GetScreenWidth();
   int sh = GetScreenHeight();
@@ -140,19 +182,50 @@ Texture2D ColorToTexture(Color color, Vector2 resolution) {
   return texture;
 }
 
+Rectangle GetCameraWorldRect(const Camera2D &camera) {
+  // Screen corners -> camera space -> logical units
+  float sw = (float)GetScreenWidth(), sh = (float)GetScreenHeight();
+  const Vector2 corners[4] = {{0, 0}, {sw, 0}, {0, sh}, {sw, sh}};
+  Vector2 scale = GetUITransform().scale;
+  Vector2 offset = GetUITransform().offset;
+
+  Vector2 min = {INFINITY, INFINITY};
+  Vector2 max = {-INFINITY, -INFINITY};
+  for (const Vector2 &corner : corners) {
+    Vector2 world = GetScreenToWorld2D(corner, camera);
+    world = {(world.x - offset.x) / scale.x, (world.y - offset.y) / scale.y};
+    min = Vector2Min(min, world);
+    max = Vector2Max(max, world);
+  }
+  return {min.x, min.y, max.x - min.x, max.y - min.y};
+}
+
+void BeginWorldCulling(const Camera2D &camera) {
+  worldCullRect = GetCameraWorldRect(camera);
+  worldCulling = true;
+}
+
+void EndWorldCulling() { worldCulling = false; }
+
+bool IsWorldRectVisible(Rectangle rect) {
+  return !worldCulling || CheckCollisionRecs(worldCullRect, rect);
+}
+
 void DrawWorldSprite(const Fumbo::Graphic2D::Object *object, Texture2D texture,
                      Rectangle source, Vector2 offset, float scale,
                      Color tint) {
   if (!object)
     return;
 
-  Rectangle aabb = object->GetAABB();
-  Vector2 uiScale = GetUIScale();
+  Rectangle aabb = object->GetInterpolatedAABB();
+  Vector2 uiScale = GetUITransform().scale;
 
   // Draw size is based on the SOURCE rectangle size scaled.
   // This allows sprites of different aspect ratios to render correctly.
+  // A flip stays in the source: a negative destination height would draw
+  // upward from drawY and cancel it.
   float drawW = fabsf(source.width) * scale;
-  float drawH = source.height * scale;
+  float drawH = fabsf(source.height) * scale;
 
   // Center the sprite on the object's center point
   float centerX = aabb.x + aabb.width * 0.5f;
@@ -161,8 +234,11 @@ void DrawWorldSprite(const Fumbo::Graphic2D::Object *object, Texture2D texture,
   float drawX = centerX - (drawW * 0.5f) + offset.x;
   float drawY = centerY - (drawH * 0.5f) + offset.y;
 
+  if (!IsWorldRectVisible({drawX, drawY, drawW, drawH}))
+    return;
+
   // Scale to screen space (1280x720 virtual resolution)
-  Vector2 globalOffset = GetUIOffset();
+  Vector2 globalOffset = GetUITransform().offset;
   Rectangle dest = {drawX * uiScale.x + globalOffset.x, drawY * uiScale.y + globalOffset.y, drawW * uiScale.x,
                     drawH * uiScale.y};
 
@@ -172,8 +248,11 @@ void DrawWorldSprite(const Fumbo::Graphic2D::Object *object, Texture2D texture,
 
 void DrawWorldSpriteAt(Rectangle worldRect, Texture2D texture,
                        Rectangle source, Color tint) {
-  Vector2 uiScale = GetUIScale();
-  Vector2 globalOffset = GetUIOffset();
+  if (!IsWorldRectVisible(worldRect))
+    return;
+
+  Vector2 uiScale = GetUITransform().scale;
+  Vector2 globalOffset = GetUITransform().offset;
 
   Rectangle dest = {
       worldRect.x * uiScale.x + globalOffset.x,
@@ -191,9 +270,9 @@ void DrawWorldSpriteTiled(const Fumbo::Graphic2D::Object *object,
   if (!object || texture.id == 0)
     return;
 
-  Rectangle aabb = object->GetAABB();
-  Vector2 uiScale = GetUIScale();
-  Vector2 globalOffset = GetUIOffset();
+  Rectangle aabb = object->GetInterpolatedAABB();
+  Vector2 uiScale = GetUITransform().scale;
+  Vector2 globalOffset = GetUITransform().offset;
 
   // tileSize = world units per full texture repeat on the tiled axis.
   // 0 means use the texture's native pixel width (or height).
@@ -212,20 +291,38 @@ void DrawWorldSpriteTiled(const Fumbo::Graphic2D::Object *object,
   float drawW = tileX ? tw : regionW;
   float drawH = tileY ? th : regionH;
 
-  int tilesX = tileX ? (int)std::ceilf(regionW / tw) : 1;
-  int tilesY = tileY ? (int)std::ceilf(regionH / th) : 1;
+  int tilesX = tileX ? (int)std::ceil(regionW / tw) : 1;
+  int tilesY = tileY ? (int)std::ceil(regionH / th) : 1;
+
+  // Clip the tile range to the camera view so off-screen tiles cost nothing
+  int firstX = 0, firstY = 0;
+  if (worldCulling) {
+    Rectangle view = worldCullRect;
+    if (!CheckCollisionRecs(view, {regionX, regionY, regionW, regionH}))
+      return;
+    if (tileX) {
+      firstX = std::max(0, (int)std::floor((view.x - regionX) / tw));
+      tilesX = std::min(tilesX,
+                        (int)std::ceil((view.x + view.width - regionX) / tw));
+    }
+    if (tileY) {
+      firstY = std::max(0, (int)std::floor((view.y - regionY) / th));
+      tilesY = std::min(tilesY,
+                        (int)std::ceil((view.y + view.height - regionY) / th));
+    }
+  }
 
   // Full source rect of the texture
   Rectangle fullSrc = {0, 0, (float)texture.width, (float)texture.height};
 
-  for (int ty = 0; ty < tilesY; ty++) {
-    for (int tx = 0; tx < tilesX; tx++) {
+  for (int ty = firstY; ty < tilesY; ty++) {
+    for (int tx = firstX; tx < tilesX; tx++) {
       float worldX = regionX + tx * tw;
       float worldY = regionY + ty * th;
 
       // How much of this tile is still inside the region
-      float clampW = std::fminf(drawW, regionX + regionW - worldX);
-      float clampH = std::fminf(drawH, regionY + regionH - worldY);
+      float clampW = std::fmin(drawW, regionX + regionW - worldX);
+      float clampH = std::fmin(drawH, regionY + regionH - worldY);
 
       // Proportionally clip the SOURCE so we only show the visible portion
       // of the texture (never stretch a partial tile).
@@ -6,8 +6,6 @@ namespace Graphic2D {
 
 // PlatformerController
 
-// PlatformerController
-
 PlatformerController::PlatformerController(Object *controlledObject)
     : object(controlledObject) {}
 
@@ -18,50 +16,68 @@ void PlatformerController::Update(bool moveLeft, bool moveRight, bool jump) {
   Vector2 velocity = object->GetVelocity();
   bool grounded = IsGrounded();
 
-  // Horizontal movement with forces
+  // Horizontal movement: accelerate towards the target speed
   float deltaTime = GetFrameTime();
   float currentControl = grounded ? 1.0f : airControl;
   float moveForce = 1500.0f;
-  float maxImpulse = moveForce * currentControl * deltaTime;
+  float maxDelta = moveForce * currentControl * deltaTime;
 
   if (moveLeft) {
       // Target velocity is -moveSpeed
-      // We only apply force if we are to the right of the target velocity (i.e. moving slower left, or moving right)
+      // We only accelerate if we are to the right of the target velocity (i.e. moving slower left, or moving right)
       if (velocity.x > -moveSpeed) {
           float needed = -moveSpeed - velocity.x;
-          // Clamp the impulse so we don't overshoot
-          float impulse = std::max(needed, -maxImpulse);
-          object->ApplyImpulse({impulse, 0});
+          // Clamp the change so we don't overshoot
+          velocity.x += std::max(needed, -maxDelta);
       }
   } else if (moveRight) {
       if (velocity.x < moveSpeed) {
           float needed = moveSpeed - velocity.x;
-          float impulse = std::min(needed, maxImpulse);
-          object->ApplyImpulse({impulse, 0});
+          velocity.x += std::min(needed, maxDelta);
       }
   } else {
     // Damping when no input
     if (grounded) {
       if (abs(velocity.x) > 1.0f) {
-        float dampingForce = -velocity.x * 20.0f;
-        object->ApplyImpulse({dampingForce * deltaTime, 0});
+        velocity.x -= velocity.x * 20.0f * deltaTime;
       } else {
-        object->SetVelocity({0, velocity.y});
+        velocity.x = 0;
       }
     }
   }
 
   // Jumping
   if (jump && grounded) {
-    object->ApplyImpulse({0, -jumpForce});
+    velocity.y = -jumpForce;
   }
+
+  // Kinematic bodies ignore forces, so integrate gravity here
+  auto &physics = object->GetWorld() ? *object->GetWorld() : Physics::Instance();
+  velocity = Vector2Add(
+      velocity, Vector2Scale(physics.GetGravity(),
+                             object->GetGravityScale() * deltaTime));
+
+  lastMove = physics.MoveAndSlide(object, Vector2Scale(velocity, deltaTime));
+
+  if (lastMove.onFloor && velocity.y > 0)
+    velocity.y = 0;
+  if (lastMove.onCeiling && velocity.y < 0)
+    velocity.y = 0;
+  if (lastMove.onWall) {
+    float into = Vector2DotProduct(velocity, lastMove.wallNormal);
+    if (into < 0)
+      velocity = Vector2Subtract(velocity,
+                                 Vector2Scale(lastMove.wallNormal, into));
+  }
+
+  object->SetVelocity(velocity);
 }
 
 
 bool PlatformerController::IsGrounded() const {
   if (!object)
     return false;
-  return abs(object->GetVelocity().y) < groundedThreshold;
+  return lastMove.onFloor;
 }
 
 // TopDownController
@@ -77,7 +93,7 @@ void TopDownController::Update(bool moveLeft, bool moveRight, bool moveUp,
   Vector2 velocity = object->GetVelocity();
   float moveForce = 2000.0f;
   float deltaTime = GetFrameTime();
-  float maxImpulse = moveForce * deltaTime;
+  float maxDelta = moveForce * deltaTime;
 
   // 4-directional movement
   Vector2 inputDirection = {0, 0};
@@ -97,37 +113,45 @@ void TopDownController::Update(bool moveLeft, bool moveRight, bool moveUp,
     inputDirection.y /= magnitude;
     
     Vector2 targetVelocity = {inputDirection.x * moveSpeed, inputDirection.y * moveSpeed};
-    Vector2 currentVelocity = object->GetVelocity();
     
     // Independent Axis Control to reach target velocity
     // This allows for smooth diagonal movement and speed limiting
     
     // X Axis
-    float diffX = targetVelocity.x - currentVelocity.x;
-
-    float impulseX = 0;
+    float diffX = targetVelocity.x - velocity.x;
     if (abs(diffX) > 0.01f) {
-        impulseX = diffX > 0 ? std::min(diffX, maxImpulse) : std::max(diffX, -maxImpulse);
+        velocity.x += diffX > 0 ? std::min(diffX, maxDelta) : std::max(diffX, -maxDelta);
     }
 
     // Y Axis
-    float diffY = targetVelocity.y - currentVelocity.y;
-    float impulseY = 0;
+    float diffY = targetVelocity.y - velocity.y;
     if (abs(diffY) > 0.01f) {
-        impulseY = diffY > 0 ? std::min(diffY, maxImpulse) : std::max(diffY, -maxImpulse);
+        velocity.y += diffY > 0 ? std::min(diffY, maxDelta) : std::max(diffY, -maxDelta);
     }
-    object->ApplyImpulse({impulseX, impulseY});
 
   } else {
     // Strong damping when no input
     if (abs(velocity.x) > 1.0f || abs(velocity.y) > 1.0f) {
       float dampingForce = 20.0f;
-      object->ApplyImpulse(
-          {-velocity.x * dampingForce * deltaTime, -velocity.y * dampingForce * deltaTime});
+      velocity.x -= velocity.x * dampingForce * deltaTime;
+      velocity.y -= velocity.y * dampingForce * deltaTime;
     } else {
-      object->SetVelocity({0, 0});
+      velocity = {0, 0};
     }
   }
+
+  // No "up" in top-down: every contact is a wall to slide along
+  auto &physics = object->GetWorld() ? *object->GetWorld() : Physics::Instance();
+  MoveResult move = physics.MoveAndSlide(
+      object, Vector2Scale(velocity, deltaTime), {0, 0});
+
+  if (move.onWall) {
+    float into = Vector2DotProduct(velocity, move.wallNormal);
+    if (into < 0)
+      velocity = Vector2Subtract(velocity, Vector2Scale(move.wallNormal, into));
+  }
+
+  object->SetVelocity(velocity);
 }
 
 } // namespace Graphic2D
@@ -3,7 +3,7 @@
 // Include this for platformer-specific helpers and controllers
 
 #include "../fumbo.hpp"
-#include "character_controller.hpp" // For ObjectConfig
+#include "character_controller.hpp"
 #include "platformer/platformer_controller.hpp"
 
 namespace Fumbo {
@@ -13,7 +13,8 @@ using namespace Graphic2D;
 
 // Create a static platform
 inline Object *CreatePlatform(Vector2 position, Vector2 size,
-                              Color color = GRAY) {
+                              Color color = GRAY,
+                              Physics &physics = Physics::Instance()) {
   Graphic2D::ObjectConfig config;
   config.position = position;
   config.size = size;
@@ -22,16 +23,13 @@ inline Object *CreatePlatform(Vector2 position, Vector2 size,
   config.friction = 0.2f;
   config.restitution = 0.0f;
 
-  Object *platform = new Object();
-  Graphic2D::ConfigureObject(platform, config);
-  Physics::Instance().AddObject(platform);
-
-  return platform;
+  return physics.GetBody(physics.CreateBody(config));
 }
 
 // Create a platformer character with good defaults
 inline Object *CreateCharacter(Vector2 position, Vector2 size,
-                               Color color = RED) {
+                               Color color = RED,
+                               Physics &physics = Physics::Instance()) {
   Graphic2D::ObjectConfig config;
   config.position = position;
   config.size = size;
@@ -40,12 +38,9 @@ inline Object *CreateCharacter(Vector2 position, Vector2 size,
   config.friction = 0.0f;
   config.restitution = 0.0f;
   config.gravityScale = 1.0f;
+  config.bodyType = BodyType::Kinematic; // Driven by PlatformerController
 
-  Object *character = new Object();
-  Graphic2D::ConfigureObject(character, config);
-  Physics::Instance().AddObject(character);
-
-  return character;
+  return physics.GetBody(physics.CreateBody(config));
 }
 
 // Create a platformer controller
@@ -11,6 +11,8 @@ void PlatformerController::Update(bool moveLeft, bool moveRight, bool jump) {
   if (!object)
     return;
 
+  auto &physics = object->GetWorld() ? *object->GetWorld()
+                                     : Graphic2D::Physics::Instance();
   Vector2 velocity = object->GetVelocity();
   bool grounded = IsGrounded();
 
@@ -20,43 +22,62 @@ void PlatformerController::Update(bool moveLeft, bool moveRight, bool jump) {
   }
   wasGrounded = grounded;
 
-  // Horizontal movement with forces
+  // Horizontal movement: accelerate towards the target speed
   float deltaTime = GetFrameTime();
   float currentControl = grounded ? 1.0f : airControl;
   float moveForce = 1500.0f;
-  float maxImpulse = moveForce * currentControl * deltaTime;
+  float maxDelta = moveForce * currentControl * deltaTime;
 
   if (moveLeft) {
       facingDirection = -1;
       if (velocity.x > -moveSpeed) {
           float needed = -moveSpeed - velocity.x;
-          float impulse = std::max(needed, -maxImpulse);
-          object->ApplyImpulse({impulse, 0});
+          velocity.x += std::max(needed, -maxDelta);
       }
   } else if (moveRight) {
       facingDirection = 1;
       if (velocity.x < moveSpeed) {
           float needed = moveSpeed - velocity.x;
-          float impulse = std::min(needed, maxImpulse);
-          object->ApplyImpulse({impulse, 0});
+          velocity.x += std::min(needed, maxDelta);
       }
   } else {
     // Damping when no input
     if (grounded) {
       if (abs(velocity.x) > 1.0f) {
-        float dampingForce = -velocity.x * 20.0f;
-        object->ApplyImpulse({dampingForce * deltaTime, 0});
+        velocity.x -= velocity.x * 20.0f * deltaTime;
       } else {
-        object->SetVelocity({0, velocity.y});
+        velocity.x = 0;
       }
     }
   }
 
   // Jumping — single jump only (canJump resets on landing)
   if (jump && grounded && canJump) {
-    object->ApplyImpulse({0, -jumpForce});
+    velocity.y = -jumpForce;
     canJump = false;
   }
+
+  // Kinematic bodies ignore forces, so integrate gravity here
+  velocity = Vector2Add(
+      velocity, Vector2Scale(physics.GetGravity(),
+                             object->GetGravityScale() * deltaTime));
+
+  lastMove = physics.MoveAndSlide(object, Vector2Scale(velocity, deltaTime));
+
+  // Cancel the velocity we lost against floors, ceilings and walls
+  if (lastMove.onFloor && velocity.y > 0)
+    velocity.y = 0;
+  if (lastMove.onCeiling && velocity.y < 0)
+    velocity.y = 0;
+  if (lastMove.onWall) {
+    float into = Vector2DotProduct(velocity, lastMove.wallNormal);
+    if (into < 0)
+      velocity = Vector2Subtract(velocity,
+                                 Vector2Scale(lastMove.wallNormal, into));
+  }
+
+  // Kept on the body so the solver can push dynamic bodies we walk into
+  object->SetVelocity(velocity);
 }
 
 void PlatformerController::ClampVelocityX() {
@@ -67,37 +88,8 @@ bool PlatformerController::IsGrounded() const {
   if (!object)
     return false;
 
-  // If moving upwards quickly, definitely not grounded
-  if (object->GetVelocity().y < -10.0f)
-    return false;
-
-  Rectangle aabb = object->GetAABB();
-  
-  // Cast rays down from bottom-left, bottom-center, and bottom-right
-  // Start slightly inside the player to ensure we cross the floor's top edge
-  float startY = aabb.y + aabb.height - 2.0f;
-  Vector2 origins[3] = {
-    { aabb.x + 2.0f, startY },
-    { aabb.x + aabb.width / 2.0f, startY },
-    { aabb.x + aabb.width - 2.0f, startY }
-  };
-  
-  Vector2 direction = { 0.0f, 1.0f }; // Straight down
-  float checkDistance = 10.0f; // Look from inside player to slightly below feet
-
-  auto& physics = Graphic2D::Physics::Instance();
-  for (int i = 0; i < 3; i++) {
-    auto hits = physics.RaycastAll(origins[i], direction, checkDistance);
-    for (const auto& hit : hits) {
-      if (hit.hit && hit.object && hit.object != object) {
-        if (hit.object->IsCollidable() && !hit.object->IsTrigger()) {
-            return true;
-        }
-      }
-    }
-  }
-
-  return false;
+  // Floor contact reported by the last MoveAndSlide
+  return lastMove.onFloor;
 }
 
 } // namespace Platformer
@@ -5,7 +5,8 @@
 namespace Fumbo {
 namespace Platformer {
 
-// Platformer-specific controller for side-scrolling games
+// Platformer-specific controller for side-scrolling games.
+// Expects a Kinematic body: movement goes through Physics::MoveAndSlide.
 class PlatformerController {
 public:
   PlatformerController(Graphic2D::Object *controlledObject);
@@ -29,13 +30,15 @@ private:
   float moveSpeed = 350.0f;
   float jumpForce = 600.0f;
   float airControl = 1.0f;
-  float groundedThreshold = 50.0f;
   int facingDirection = 1; // 1 for right, -1 for left
 
   // Jump control: prevents double-jump
   bool canJump = true;      // allowed to jump right now?
   bool wasGrounded = false; // grounded state from previous frame
 
+  // Contact flags from the most recent move
+  Graphic2D::MoveResult lastMove = {};
+
   void ClampVelocityX();
 };
 
@@ -3,7 +3,7 @@
 // Include this for top-down game helpers (Stardew Valley, Zelda style)
 
 #include "../fumbo.hpp"
-#include "character_controller.hpp" // For ObjectConfig
+#include "character_controller.hpp"
 #include "topdown/topdown_controller.hpp"
 
 namespace Fumbo {
@@ -13,7 +13,8 @@ using namespace Graphic2D;
 
 // Create a wall/obstacle for top-down games
 inline Object *CreateWall(Vector2 position, Vector2 size,
-                          Color color = DARKGRAY) {
+                          Color color = DARKGRAY,
+                          Physics &physics = Physics::Instance()) {
   Graphic2D::ObjectConfig config;
   config.position = position;
   config.size = size;
@@ -23,16 +24,13 @@ inline Object *CreateWall(Vector2 position, Vector2 size,
   config.restitution = 0.0f;
   config.gravityScale = 0.0f; // No gravity in top-down
 
-  Object *wall = new Object();
-  Graphic2D::ConfigureObject(wall, config);
-  Physics::Instance().AddObject(wall);
-
-  return wall;
+  return physics.GetBody(physics.CreateBody(config));
 }
 
 // Create a top-down character with proper settings
 inline Object *CreateCharacter(Vector2 position, Vector2 size,
-                               Color color = BLUE) {
+                               Color color = BLUE,
+                               Physics &physics = Physics::Instance()) {
   Graphic2D::ObjectConfig config;
   config.position = position;
   config.size = size;
@@ -41,12 +39,9 @@ inline Object *CreateCharacter(Vector2 position, Vector2 size,
   config.friction = 0.0f;
   config.restitution = 0.0f;
   config.gravityScale = 0.0f; // CRITICAL: No gravity for top-down!
+  config.bodyType = BodyType::Kinematic; // Driven by TopDownController
 
-  Object *character = new Object();
-  Graphic2D::ConfigureObject(character, config);
-  Physics::Instance().AddObject(character);
-
-  return character;
+  return physics.GetBody(physics.CreateBody(config));
 }
 
 // Create a top-down controller
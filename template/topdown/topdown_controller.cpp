@@ -28,7 +28,7 @@ void TopDownController::Update(bool moveLeft, bool moveRight, bool moveUp, bool
   }
   
   float deltaTime = GetFrameTime();
-  float maxImpulse = moveForce * deltaTime;
+  float maxDelta = moveForce * deltaTime;
 
   if (magnitude > 0) {
     Vector2 targetVelocity = {inputDirection.x * moveSpeed, inputDirection.y * moveSpeed};
@@ -36,31 +36,41 @@ void TopDownController::Update(bool moveLeft, bool moveRight, bool moveUp, bool
     // Independent Axis Control to reach target velocity
     // X Axis
     float diffX = targetVelocity.x - velocity.x;
-    float impulseX = 0;
-    // Only apply force if there is a significant difference
+    // Only accelerate if there is a significant difference
     if (abs(diffX) > 0.1f) {
-        impulseX = diffX > 0 ? std::min(diffX, maxImpulse) : std::max(diffX, -maxImpulse);
+        velocity.x += diffX > 0 ? std::min(diffX, maxDelta) : std::max(diffX, -maxDelta);
     }
 
     // Y Axis
     float diffY = targetVelocity.y - velocity.y;
-    float impulseY = 0;
     if (abs(diffY) > 0.1f) {
-        impulseY = diffY > 0 ? std::min(diffY, maxImpulse) : std::max(diffY, -maxImpulse);
+        velocity.y += diffY > 0 ? std::min(diffY, maxDelta) : std::max(diffY, -maxDelta);
     }
-    
-    object->ApplyImpulse({impulseX, impulseY});
 
   } else {
     // Strong damping when no input
     if (abs(velocity.x) > 1.0f || abs(velocity.y) > 1.0f) {
       float dampingForce = 20.0f;
-      object->ApplyImpulse({-velocity.x * dampingForce * deltaTime, -velocity.y * dampingForce * deltaTime});
+      velocity.x -= velocity.x * dampingForce * deltaTime;
+      velocity.y -= velocity.y * dampingForce * deltaTime;
     } else {
-      object->SetVelocity({0, 0});
+      velocity = {0, 0};
     }
   }
 
+  // No "up" in top-down: every contact is a wall to slide along
+  auto &physics = object->GetWorld() ? *object->GetWorld()
+                                     : Graphic2D::Physics::Instance();
+  Graphic2D::MoveResult move =
+      physics.MoveAndSlide(object, Vector2Scale(velocity, deltaTime), {0, 0});
+
+  if (move.onWall) {
+    float into = Vector2DotProduct(velocity, move.wallNormal);
+    if (into < 0)
+      velocity = Vector2Subtract(velocity, Vector2Scale(move.wallNormal, into));
+  }
+
+  object->SetVelocity(velocity);
 }
 
 
@@ -5,7 +5,8 @@
 namespace Fumbo {
 namespace TopDown {
 
-// Top-down controller for games like Stardew Valley, Zelda
+// Top-down controller for games like Stardew Valley, Zelda.
+// Expects a Kinematic body: movement goes through Physics::MoveAndSlide.
 class TopDownController {
 public:
   TopDownController(Graphic2D::Object *controlledObject);